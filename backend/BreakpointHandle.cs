@@ -109,6 +109,28 @@ namespace Mono.Debugger.Backend
 				inferior.RemoveBreakpoint (this);
 			has_breakpoint = false;
 		}
+
+		// <summary>
+		//   Insert all the @handles with one server call.  Returns null for each
+		//   handle we could insert and the exception we got for the others.
+		// </summary>
+		internal static TargetException[] Insert (Inferior inferior,
+							  AddressBreakpointHandle[] handles)
+		{
+			TargetAddress[] addresses = new TargetAddress [handles.Length];
+			for (int i = 0; i < handles.Length; i++)
+				addresses [i] = handles [i].Address;
+
+			TargetException[] errors = inferior.BreakpointManager.InsertBreakpoints (
+				inferior, handles, addresses, -1);
+
+			for (int i = 0; i < handles.Length; i++) {
+				if (errors [i] == null)
+					handles [i].has_breakpoint = true;
+			}
+
+			return errors;
+		}
 	}
 
 	internal abstract class FunctionBreakpointHandle : BreakpointHandle
@@ -155,6 +177,23 @@ namespace Mono.Debugger.Backend
 
 		internal abstract void MethodLoaded (TargetAccess target, Method method);
 
+		// <summary>
+		//   The address where we insert the breakpoint when @method is loaded or
+		//   TargetAddress.Null if it doesn't have one.
+		// </summary>
+		internal TargetAddress GetMethodAddress (Method method)
+		{
+			if (line != -1) {
+				if (method.HasLineNumbers)
+					return method.LineNumberTable.Lookup (line, column);
+				else
+					return TargetAddress.Null;
+			} else if (method.HasMethodBounds)
+				return method.MethodStartAddress;
+			else
+				return method.StartAddress;
+		}
+
 		public override string ToString ()
 		{
 			return String.Format ("{0} ({1}:{2})", GetType (), function, line);
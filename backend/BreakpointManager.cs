@@ -1,6 +1,7 @@
 using System;
 using System.Threading;
 using System.Collections;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
 namespace Mono.Debugger.Backend
@@ -31,6 +32,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern void mono_debugger_breakpoint_manager_unlock ();
 
+		[DllImport("monodebuggerserver")]
+		static extern void mono_debugger_breakpoint_manager_get_hit_counts (IntPtr manager, int count, int[] ids, long[] hit_counts);
+
 		[DllImport("monodebuggerserver")]
 		static extern int mono_debugger_breakpoint_info_get_id (IntPtr info);
 
@@ -141,6 +145,7 @@ namespace Mono.Debugger.Backend
 				switch (handle.Breakpoint.Type) {
 				case EventType.Breakpoint:
 					index = inferior.InsertBreakpoint (address);
+					set_condition (inferior, handle.Breakpoint, index, address);
 					break;
 
 				case EventType.WatchRead:
@@ -166,20 +171,182 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Insert software breakpoints for all the @handles at the corresponding
+		//   @addresses with one server call.  Returns null for each handle we could
+		//   insert and the exception we got for the others.
+		//
+		//   Like InsertBreakpoint(), we only insert one breakpoint per address; if
+		//   an address appears more than once in the batch, the later handles get
+		//   an AlreadyHaveBreakpoint error.
+		// </summary>
+		public TargetException[] InsertBreakpoints (Inferior inferior, BreakpointHandle[] handles,
+							    TargetAddress[] addresses, int domain)
+		{
+			Lock ();
+			try {
+				TargetException[] errors = new TargetException [handles.Length];
+				List<int> pending = new List<int> ();
+				Dictionary<long,int> pending_by_address = new Dictionary<long,int> ();
+
+				for (int i = 0; i < handles.Length; i++) {
+					int index, first;
+					bool is_enabled;
+					BreakpointHandle old = LookupBreakpoint (
+						addresses [i], out index, out is_enabled);
+					if (old != null)
+						errors [i] = new TargetException (
+							TargetError.AlreadyHaveBreakpoint,
+							"Already have breakpoint {0} at address {1}.",
+							old.Breakpoint.Index, addresses [i]);
+					else if (pending_by_address.TryGetValue (addresses [i].Address, out first))
+						errors [i] = new TargetException (
+							TargetError.AlreadyHaveBreakpoint,
+							"Already have breakpoint {0} at address {1}.",
+							handles [first].Breakpoint.Index, addresses [i]);
+					else if (handles [i].Breakpoint.Type != EventType.Breakpoint)
+						errors [i] = new TargetException (
+							TargetError.InternalError,
+							"Cannot insert {0} together with other breakpoints.",
+							handles [i].Breakpoint);
+					else {
+						pending.Add (i);
+						pending_by_address.Add (addresses [i].Address, i);
+					}
+				}
+
+				TargetAddress[] pending_addresses = new TargetAddress [pending.Count];
+				for (int i = 0; i < pending.Count; i++)
+					pending_addresses [i] = addresses [pending [i]];
+
+				int[] indices = inferior.InsertBreakpoints (pending_addresses);
+
+				for (int i = 0; i < pending.Count; i++) {
+					int pos = pending [i];
+					int index = indices [i];
+
+					try {
+						//
+						// Insert it again to get the actual error.
+						//
+						if (index == 0)
+							index = inferior.InsertBreakpoint (addresses [pos]);
+
+						set_condition (inferior, handles [pos].Breakpoint, index, addresses [pos]);
+						index_hash.Add (index, new BreakpointEntry (handles [pos], domain));
+					} catch (TargetException ex) {
+						errors [pos] = ex;
+					}
+				}
+
+				return errors;
+			} finally {
+				Unlock ();
+			}
+		}
+
+		// <summary>
+		//   Let the server filter out hits of breakpoints which have a condition or
+		//   only break in one single thread.
+		//
+		//   This is called right after inserting the breakpoint at @index, before
+		//   we add it to the `index_hash'; if it fails, we remove the breakpoint
+		//   again, so it doesn't stay in the target without us tracking it.
+		// </summary>
+		void set_condition (Inferior inferior, Breakpoint bpt, int index, TargetAddress address)
+		{
+			int thread = 0;
+			ThreadGroup group = bpt.ThreadGroup;
+			if (!group.IsSystem && !group.IsGlobal && (group.Threads.Length == 1)) {
+				SingleSteppingEngine engine = inferior.Process.ThreadManager.GetEngine (
+					group.Threads [0]);
+				if (engine != null)
+					thread = engine.PID;
+			}
+
+			if ((bpt.Condition == null) && (thread == 0))
+				return;
+
+			try {
+				inferior.SetBreakpointCondition (index, address, bpt.Condition, thread);
+			} catch {
+				try {
+					inferior.RemoveBreakpoint (index);
+				} catch {
+				}
+				throw;
+			}
+		}
+
+		// <summary>
+		//   Returns the number of times each of the @breakpoints was hit (and its
+		//   condition was true), summed over all the places where it is inserted.
+		//   The counters are maintained by the server, so this also works for
+		//   counting probes which never stop the target.
+		// </summary>
+		public long[] GetHitCounts (Breakpoint[] breakpoints)
+		{
+			Lock ();
+			try {
+				int[] indices = new int [index_hash.Count];
+				index_hash.Keys.CopyTo (indices, 0);
+
+				long[] counts = new long [indices.Length];
+				mono_debugger_breakpoint_manager_get_hit_counts (
+					_manager, indices.Length, indices, counts);
+
+				Dictionary<Breakpoint,int> positions = new Dictionary<Breakpoint,int> ();
+				for (int i = 0; i < breakpoints.Length; i++) {
+					if (!positions.ContainsKey (breakpoints [i]))
+						positions.Add (breakpoints [i], i);
+				}
+
+				long[] retval = new long [breakpoints.Length];
+				for (int i = 0; i < indices.Length; i++) {
+					BreakpointEntry entry = (BreakpointEntry) index_hash [indices [i]];
+					int pos;
+					if (positions.TryGetValue (entry.Handle.Breakpoint, out pos))
+						retval [pos] += counts [i];
+				}
+
+				return retval;
+			} finally {
+				Unlock ();
+			}
+		}
+
 		public void RemoveBreakpoint (Inferior inferior, BreakpointHandle handle)
+		{
+			RemoveBreakpoints (inferior, new BreakpointHandle[] { handle });
+		}
+
+		// <summary>
+		//   Remove all the breakpoints which belong to one of the @handles with
+		//   one server call.
+		// </summary>
+		public void RemoveBreakpoints (Inferior inferior, BreakpointHandle[] handles)
 		{
 			Lock ();
 			try {
 				int[] indices = new int [index_hash.Count];
 				index_hash.Keys.CopyTo (indices, 0);
 
+				Dictionary<BreakpointHandle,bool> handle_hash;
+				handle_hash = new Dictionary<BreakpointHandle,bool> ();
+				foreach (BreakpointHandle handle in handles)
+					handle_hash [handle] = true;
+
+				List<int> removed = new List<int> ();
 				for (int i = 0; i < indices.Length; i++) {
 					BreakpointEntry entry = (BreakpointEntry) index_hash [indices [i]];
-					if (entry.Handle != handle)
+					if (!handle_hash.ContainsKey (entry.Handle))
 						continue;
-					inferior.RemoveBreakpoint (indices [i]);
 					index_hash.Remove (indices [i]);
+					removed.Add (indices [i]);
 				}
+
+				if (removed.Count > 0)
+					inferior.RemoveBreakpoints (removed.ToArray ());
 			} finally {
 				Unlock ();
 			}
@@ -192,20 +359,16 @@ namespace Mono.Debugger.Backend
 				int[] indices = new int [index_hash.Count];
 				index_hash.Keys.CopyTo (indices, 0);
 
+				List<int> removed = new List<int> ();
 				for (int i = 0; i < indices.Length; i++) {
 					int idx = indices [i];
 					BreakpointEntry entry = (BreakpointEntry) index_hash [idx];
-					SourceBreakpoint bpt = entry.Handle.Breakpoint as SourceBreakpoint;
-
-					if (!entry.Handle.Breakpoint.ThreadGroup.IsGlobal) {
-						try {
-							inferior.RemoveBreakpoint (idx);
-						} catch (Exception ex) {
-							Report.Error ("Removing breakpoint {0} failed: {1}",
-								      idx, ex);
-						}
-					}
+
+					if (!entry.Handle.Breakpoint.ThreadGroup.IsGlobal)
+						removed.Add (idx);
 				}
+
+				remove_breakpoints (inferior, removed.ToArray ());
 			} finally {
 				Unlock ();
 			}
@@ -218,19 +381,25 @@ namespace Mono.Debugger.Backend
 				int[] indices = new int [index_hash.Count];
 				index_hash.Keys.CopyTo (indices, 0);
 
-				for (int i = 0; i < indices.Length; i++) {
-					try {
-						inferior.RemoveBreakpoint (indices [i]);
-					} catch (Exception ex) {
-						Report.Error ("Removing breakpoint {0} failed: {1}",
-							      indices [i], ex);
-					}
-				}
+				remove_breakpoints (inferior, indices);
 			} finally {
 				Unlock ();
 			}
 		}
 
+		void remove_breakpoints (Inferior inferior, int[] indices)
+		{
+			if (indices.Length == 0)
+				return;
+
+			try {
+				inferior.RemoveBreakpoints (indices);
+			} catch (Exception ex) {
+				Report.Error ("Removing breakpoints {0} failed: {1}",
+					      String.Join (",", Array.ConvertAll (indices, i => i.ToString ())), ex);
+			}
+		}
+
 		public void DomainUnload (Inferior inferior, int domain)
 		{
 			Lock ();
@@ -238,13 +407,17 @@ namespace Mono.Debugger.Backend
 				int[] indices = new int [index_hash.Count];
 				index_hash.Keys.CopyTo (indices, 0);
 
+				List<int> removed = new List<int> ();
 				for (int i = 0; i < indices.Length; i++) {
 					BreakpointEntry entry = (BreakpointEntry) index_hash [indices [i]];
 					if (entry.Domain != domain)
 						continue;
-					inferior.RemoveBreakpoint (indices [i]);
 					index_hash.Remove (indices [i]);
+					removed.Add (indices [i]);
 				}
+
+				if (removed.Count > 0)
+					inferior.RemoveBreakpoints (removed.ToArray ());
 			} finally {
 				Unlock ();
 			}
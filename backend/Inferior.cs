@@ -11,6 +11,7 @@ using System.Collections.Specialized;
 using System.Runtime.InteropServices;
 
 using Mono.Debugger.Languages;
+using Mono.Debugger.Architectures;
 
 namespace Mono.Debugger.Backend
 {
@@ -35,6 +36,7 @@ namespace Mono.Debugger.Backend
 		bool initialized;
 		bool has_target;
 		bool pushed_regs;
+		bool is_running;
 
 		TargetMemoryInfo target_info;
 		Architecture arch;
@@ -84,6 +86,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_step (IntPtr handle);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_step_range (IntPtr handle, long start, long end);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_continue (IntPtr handle);
 
@@ -102,6 +107,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_write_memory (IntPtr handle, long start, int size, IntPtr data);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_read_memory_vector (IntPtr handle, int count, long[] addresses, int[] sizes, IntPtr data);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_get_target_info (out int target_int_size, out int target_long_size, out int target_address_size, out int is_bigendian);
 
@@ -129,6 +137,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_execute_instruction (IntPtr handle, IntPtr instruction, int insn_size, bool update_ip);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_execute_displaced_instruction (IntPtr handle, IntPtr instruction, int insn_size, int disp_offset);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_insert_breakpoint (IntPtr handle, long address, out int breakpoint);
 
@@ -138,15 +149,27 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_remove_breakpoint (IntPtr handle, int breakpoint);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_insert_breakpoints (IntPtr handle, int count, long[] addresses, int[] breakpoints);
+
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_remove_breakpoints (IntPtr handle, int count, int[] breakpoints);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_enable_breakpoint (IntPtr handle, int breakpoint);
 
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_disable_breakpoint (IntPtr handle, int breakpoint);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_set_breakpoint_condition (IntPtr handle, int breakpoint, ref ServerBreakpointCondition condition);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_get_registers (IntPtr handle, IntPtr values);
 
+		[DllImport("monodebuggerserver")]
+		static extern void mono_debugger_server_get_registers_multiple (int count, IntPtr[] handles, int num_registers, long[] values, int stack_size, byte[] stack, TargetError[] results);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_set_registers (IntPtr handle, IntPtr values);
 
@@ -156,6 +179,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_stop_and_wait (IntPtr handle, out int status);
 
+		[DllImport("monodebuggerserver")]
+		static extern void mono_debugger_server_stop_all (IntPtr[] handles, int count, int[] statuses, TargetError[] results);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_set_signal (IntPtr handle, int signal, int send_it);
 
@@ -177,6 +203,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_get_threads (IntPtr handle, out int count, out IntPtr data);
 
+		[DllImport("monodebuggerserver")]
+		static extern TargetError mono_debugger_server_get_thread_count (IntPtr handle, out int count);
+
 		[DllImport("monodebuggerserver")]
 		static extern TargetError mono_debugger_server_get_application (IntPtr handle, out IntPtr exe_file, out IntPtr cwd, out int nargs, out IntPtr data);
 
@@ -222,6 +251,7 @@ namespace Mono.Debugger.Backend
 			CHILD_INTERRUPTED,
 			RUNTIME_INVOKE_DONE,
 			INTERNAL_ERROR,
+			CHILD_RESUMED,
 
 			UNHANDLED_EXCEPTION	= 4001,
 			THROW_EXCEPTION,
@@ -309,6 +339,29 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Must match `BreakpointCondition' in breakpoints.h.
+		// </summary>
+		[StructLayout(LayoutKind.Sequential)]
+		private struct ServerBreakpointCondition
+		{
+			public BreakpointCondition.ConditionType Type;
+			public BreakpointConditionOperator Operator;
+			public int Register;
+			public int Size;
+			public long Offset;
+			public long Value;
+			public int Thread;
+			public int IgnoreCount;
+			public bool CountOnly;
+			public int SampleInterval;
+			public int InstructionSize;
+			[MarshalAs(UnmanagedType.ByValArray, SizeConst=MaxInstructionSize)]
+			public byte[] Instruction;
+
+			public const int MaxInstructionSize = 16;
+		}
+
 		protected Inferior (ThreadManager thread_manager, Process process,
 				    ProcessStart start, BreakpointManager bpm,
 				    DebuggerErrorHandler error_handler,
@@ -377,6 +430,7 @@ namespace Mono.Debugger.Backend
 
 			TargetState old_state = change_target_state (TargetState.Busy);
 			try {
+				target_resumed ();
 				check_error (mono_debugger_server_call_method (
 					server_handle, method.Address, data1, data2,
 					callback_arg));
@@ -393,6 +447,7 @@ namespace Mono.Debugger.Backend
 
 			TargetState old_state = change_target_state (TargetState.Running);
 			try {
+				target_resumed ();
 				check_error (mono_debugger_server_call_method_1 (
 					server_handle, method.Address, arg1, arg2, arg3,
 					arg4, callback_arg));
@@ -417,6 +472,7 @@ namespace Mono.Debugger.Backend
 					Marshal.Copy (data, 0, data_ptr, data_size);
 				}
 
+				target_resumed ();
 				check_error (mono_debugger_server_call_method_2 (
 					server_handle, method.Address,
 					data_size, data_ptr, callback_arg));
@@ -449,6 +505,7 @@ namespace Mono.Debugger.Backend
 					Marshal.Copy (blob, 0, blob_data, blob.Length);
 				}
 
+				target_resumed ();
 				check_error (mono_debugger_server_call_method_3 (
 					server_handle, method.Address, method_argument,
 					address, blob != null ? blob.Length : 0, blob_data, callback_arg));
@@ -515,6 +572,7 @@ namespace Mono.Debugger.Backend
 				offset_data = Marshal.AllocHGlobal (length * 4);
 				Marshal.Copy (blob_offsets, 0, offset_data, length);
 
+				target_resumed ();
 				check_error (mono_debugger_server_call_method_invoke (
 					server_handle, invoke_method.Address, method_argument.Address,
 					length, blob_size, param_data, offset_data, blob_data,
@@ -536,6 +594,7 @@ namespace Mono.Debugger.Backend
 				data = Marshal.AllocHGlobal (instruction.Length);
 				Marshal.Copy (instruction, 0, data, instruction.Length);
 
+				target_resumed ();
 				check_error (mono_debugger_server_execute_instruction (
 					server_handle, data, instruction.Length, update_ip));
 			} finally {
@@ -543,6 +602,33 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Run the IP-relative instruction @instruction, which has been read from
+		//   the current IP, out of line.  Returns false without resuming the target
+		//   if the code buffer is too far away to reach its operand.
+		// </summary>
+		public bool ExecuteDisplacedInstruction (byte[] instruction, int disp_offset)
+		{
+			check_disposed ();
+
+			IntPtr data = IntPtr.Zero;
+			try {
+				data = Marshal.AllocHGlobal (instruction.Length);
+				Marshal.Copy (instruction, 0, data, instruction.Length);
+
+				TargetError result = mono_debugger_server_execute_displaced_instruction (
+					server_handle, data, instruction.Length, disp_offset);
+				if (result == TargetError.DisplacementOutOfRange)
+					return false;
+
+				check_error (result);
+				target_resumed ();
+				return true;
+			} finally {
+				Marshal.FreeHGlobal (data);
+			}
+		}
+
 		public void MarkRuntimeInvokeFrame ()
 		{
 			check_error (mono_debugger_server_mark_rti_frame (server_handle));
@@ -557,11 +643,29 @@ namespace Mono.Debugger.Backend
 		public int InsertBreakpoint (TargetAddress address)
 		{
 			int retval;
+			invalidate_memory_cache ();
 			check_error (mono_debugger_server_insert_breakpoint (
 				server_handle, address.Address, out retval));
 			return retval;
 		}
 
+		// <summary>
+		//   Insert breakpoints at all the @addresses with one server call.  An
+		//   entry in the returned array is 0 if we could not insert that breakpoint.
+		// </summary>
+		public int[] InsertBreakpoints (TargetAddress[] addresses)
+		{
+			long[] addrs = new long [addresses.Length];
+			for (int i = 0; i < addresses.Length; i++)
+				addrs [i] = addresses [i].Address;
+
+			int[] retval = new int [addresses.Length];
+			invalidate_memory_cache ();
+			check_error (mono_debugger_server_insert_breakpoints (
+				server_handle, addrs.Length, addrs, retval));
+			return retval;
+		}
+
 		public int InsertHardwareBreakpoint (TargetAddress address, bool fallback,
 						     out int index)
 		{
@@ -583,10 +687,18 @@ namespace Mono.Debugger.Backend
 
 		public void RemoveBreakpoint (int breakpoint)
 		{
+			invalidate_memory_cache ();
 			check_error (mono_debugger_server_remove_breakpoint (
 				server_handle, breakpoint));
 		}
 
+		public void RemoveBreakpoints (int[] breakpoints)
+		{
+			invalidate_memory_cache ();
+			check_error (mono_debugger_server_remove_breakpoints (
+				server_handle, breakpoints.Length, breakpoints));
+		}
+
 		public int InsertHardwareWatchPoint (TargetAddress address,
 						     HardwareBreakpointType type,
 						     out int index)
@@ -599,16 +711,63 @@ namespace Mono.Debugger.Backend
 
 		public void EnableBreakpoint (int breakpoint)
 		{
+			invalidate_memory_cache ();
 			check_error (mono_debugger_server_enable_breakpoint (
 				server_handle, breakpoint));
 		}
 
 		public void DisableBreakpoint (int breakpoint)
 		{
+			invalidate_memory_cache ();
 			check_error (mono_debugger_server_disable_breakpoint (
 				server_handle, breakpoint));
 		}
 
+		// <summary>
+		//   Let the server evaluate @condition each time breakpoint @breakpoint is hit
+		//   and skip the breakpoint without stopping if it's false.  If @thread is not
+		//   zero, the breakpoint only breaks in the thread with that LWP.
+		// </summary>
+		public void SetBreakpointCondition (int breakpoint, TargetAddress address,
+						    BreakpointCondition condition, int thread)
+		{
+			ServerBreakpointCondition server_condition = new ServerBreakpointCondition ();
+			server_condition.Instruction = new byte [ServerBreakpointCondition.MaxInstructionSize];
+			server_condition.Thread = thread;
+
+			if (condition != null) {
+				server_condition.Type = condition.Type;
+				server_condition.Operator = condition.Operator;
+				server_condition.Register = condition.Register;
+				server_condition.Size = condition.Size;
+				server_condition.Offset = condition.Offset;
+				server_condition.Value = condition.Value;
+				server_condition.IgnoreCount = condition.IgnoreCount;
+				server_condition.CountOnly = condition.CountOnly;
+				server_condition.SampleInterval = condition.SampleInterval;
+			}
+
+			//
+			// The server can only step over the breakpoint by executing the original
+			// instruction out of line; jumps, calls and IP-relative instructions
+			// need to be stepped over by the engine.
+			//
+			Instruction insn = null;
+			if (process.CanExecuteCode)
+				insn = Architecture.ReadInstruction (this, address);
+
+			if ((insn != null) && insn.HasInstructionSize && !insn.IsIpRelative &&
+			    (insn.InstructionSize <= ServerBreakpointCondition.MaxInstructionSize) &&
+			    ((insn.InstructionType == Instruction.Type.Unknown) ||
+			     (insn.InstructionType == Instruction.Type.Interpretable))) {
+				server_condition.InstructionSize = insn.InstructionSize;
+				Array.Copy (insn.Code, server_condition.Instruction, insn.InstructionSize);
+			}
+
+			check_error (mono_debugger_server_set_breakpoint_condition (
+				server_handle, breakpoint, ref server_condition));
+		}
+
 		public void RestartNotification ()
 		{
 			check_error (mono_debugger_server_restart_notification (server_handle));
@@ -741,6 +900,8 @@ namespace Mono.Debugger.Backend
 			int opt_data_size;
 			IntPtr opt_data;
 
+			target_stopped ();
+
 			message = mono_debugger_server_dispatch_event (
 				server_handle, status, out arg, out data1, out data2,
 				out opt_data_size, out opt_data);
@@ -763,6 +924,10 @@ namespace Mono.Debugger.Backend
 
 			case ChildEventType.CHILD_EXECD:
 				break;
+
+			case ChildEventType.CHILD_RESUMED:
+				target_resumed ();
+				break;
 			}
 
 			if (opt_data_size > 0) {
@@ -925,11 +1090,56 @@ namespace Mono.Debugger.Backend
 			return data;
 		}
 
+		TargetMemoryCache memory_cache {
+			get { return process != null ? process.MemoryCache : null; }
+		}
+
+		void target_resumed ()
+		{
+			TargetMemoryCache cache = memory_cache;
+			if (cache == null)
+				return;
+
+			if (is_running)
+				cache.Invalidate ();
+			else {
+				is_running = true;
+				cache.ThreadResumed ();
+			}
+		}
+
+		void target_stopped ()
+		{
+			TargetMemoryCache cache = memory_cache;
+			if ((cache == null) || !is_running)
+				return;
+
+			is_running = false;
+			cache.ThreadStopped ();
+		}
+
+		void invalidate_memory_cache ()
+		{
+			TargetMemoryCache cache = memory_cache;
+			if (cache != null)
+				cache.Invalidate ();
+		}
+
 		public override byte[] ReadBuffer (TargetAddress address, int size)
 		{
 			check_disposed ();
 			if (size == 0)
 				return new byte [0];
+
+			TargetMemoryCache cache = memory_cache;
+			if (cache != null)
+				return cache.ReadBuffer (this, address, size);
+
+			return ReadBufferUncached (address, size);
+		}
+
+		internal byte[] ReadBufferUncached (TargetAddress address, int size)
+		{
 			IntPtr data = IntPtr.Zero;
 			try {
 				data = read_buffer (address, size);
@@ -941,40 +1151,79 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
-		public override byte ReadByte (TargetAddress address)
+		public override byte[][] ReadBuffers (TargetAddress[] addresses, int[] sizes)
 		{
 			check_disposed ();
-			IntPtr data = IntPtr.Zero;
+			if (addresses.Length != sizes.Length)
+				throw new ArgumentException ();
+
+			TargetMemoryCache cache = memory_cache;
+			if (cache != null)
+				return cache.ReadBuffers (this, addresses, sizes);
+
+			return ReadBuffersUncached (addresses, sizes);
+		}
+
+		internal byte[][] ReadBuffersUncached (TargetAddress[] addresses, int[] sizes)
+		{
+			int count = addresses.Length;
+			long[] starts = new long [count];
+			int total_size = 0;
+			for (int i = 0; i < count; i++) {
+				starts [i] = addresses [i].Address;
+				total_size += sizes [i];
+			}
+
+			byte[][] retval = new byte [count][];
+			if (total_size == 0) {
+				for (int i = 0; i < count; i++)
+					retval [i] = new byte [0];
+				return retval;
+			}
+
+			IntPtr data = Marshal.AllocHGlobal (total_size);
 			try {
-				data = read_buffer (address, 1);
-				return Marshal.ReadByte (data);
+				TargetError result = mono_debugger_server_read_memory_vector (
+					server_handle, count, starts, sizes, data);
+				if (result == TargetError.MemoryAccess) {
+					//
+					// Read them one by one to find out which of the regions
+					// is inaccessible.
+					//
+					for (int i = 0; i < count; i++)
+						retval [i] = ReadBufferUncached (addresses [i], sizes [i]);
+					return retval;
+				} else if (result != TargetError.None)
+					throw new TargetException (result);
+
+				int offset = 0;
+				for (int i = 0; i < count; i++) {
+					retval [i] = new byte [sizes [i]];
+					Marshal.Copy ((IntPtr) (data.ToInt64 () + offset), retval [i], 0, sizes [i]);
+					offset += sizes [i];
+				}
+				return retval;
 			} finally {
 				Marshal.FreeHGlobal (data);
 			}
 		}
 
+		public override byte ReadByte (TargetAddress address)
+		{
+			check_disposed ();
+			return ReadBuffer (address, 1) [0];
+		}
+
 		public override int ReadInteger (TargetAddress address)
 		{
 			check_disposed ();
-			IntPtr data = IntPtr.Zero;
-			try {
-				data = read_buffer (address, 4);
-				return Marshal.ReadInt32 (data);
-			} finally {
-				Marshal.FreeHGlobal (data);
-			}
+			return BitConverter.ToInt32 (ReadBuffer (address, 4), 0);
 		}
 
 		public override long ReadLongInteger (TargetAddress address)
 		{
 			check_disposed ();
-			IntPtr data = IntPtr.Zero;
-			try {
-				data = read_buffer (address, 8);
-				return Marshal.ReadInt64 (data);
-			} finally {
-				Marshal.FreeHGlobal (data);
-			}
+			return BitConverter.ToInt64 (ReadBuffer (address, 8), 0);
 		}
 
 		public override TargetAddress ReadAddress (TargetAddress address)
@@ -1006,14 +1255,23 @@ namespace Mono.Debugger.Backend
 			check_disposed ();
 			StringBuilder sb = new StringBuilder ();
 
+			//
+			// Read up to the end of the current page at a time; if the first byte
+			// is readable, then so is the rest of the page.
+			//
 			while (true) {
-				byte b = ReadByte (address);
-				address++;
+				int page_size = TargetMemoryCache.PageSize;
+				int size = page_size - (int) (address.Address & (page_size - 1));
+				byte[] buffer = ReadBuffer (address, size);
 
-				if (b == 0)
-					return sb.ToString ();
+				for (int i = 0; i < size; i++) {
+					if (buffer [i] == 0)
+						return sb.ToString ();
+
+					sb.Append ((char) buffer [i]);
+				}
 
-				sb.Append ((char) b);
+				address += size;
 			}
 		}
 
@@ -1163,8 +1421,30 @@ namespace Mono.Debugger.Backend
 
 			TargetState old_state = change_target_state (TargetState.Running);
 			try {
+				target_resumed ();
 				check_error (mono_debugger_server_step (server_handle));
 			} catch {
+				target_stopped ();
+				change_target_state (old_state);
+				throw;
+			}
+		}
+
+		// <summary>
+		//   Single-step until we leave the [start, end) range or reach a call
+		//   instruction or a breakpoint; the server only reports the final stop.
+		// </summary>
+		public void StepRange (TargetAddress start, TargetAddress end)
+		{
+			check_disposed ();
+
+			TargetState old_state = change_target_state (TargetState.Running);
+			try {
+				target_resumed ();
+				check_error (mono_debugger_server_step_range (
+					server_handle, start.Address, end.Address));
+			} catch {
+				target_stopped ();
 				change_target_state (old_state);
 				throw;
 			}
@@ -1175,8 +1455,10 @@ namespace Mono.Debugger.Backend
 			check_disposed ();
 			TargetState old_state = change_target_state (TargetState.Running);
 			try {
+				target_resumed ();
 				check_error (mono_debugger_server_continue (server_handle));
 			} catch {
+				target_stopped ();
 				change_target_state (old_state);
 				throw;
 			}
@@ -1188,8 +1470,10 @@ namespace Mono.Debugger.Backend
 
 			TargetState old_state = change_target_state (TargetState.Running);
 			try {
+				target_resumed ();
 				check_error (mono_debugger_server_resume (server_handle));
 			} catch {
+				target_stopped ();
 				change_target_state (old_state);
 				throw;
 			}
@@ -1211,6 +1495,7 @@ namespace Mono.Debugger.Backend
 				new_event = null;
 				return false;
 			} else if (status == 0) {
+				target_stopped ();
 				new_event = null;
 				return true;
 			}
@@ -1219,6 +1504,38 @@ namespace Mono.Debugger.Backend
 			return true;
 		}
 
+		// <summary>
+		//   Stop all of @inferiors.  This is the same as calling Stop(out ChildEvent)
+		//   on each of them, but all the threads are signalled before we wait for
+		//   any of them, so we don't need one round-trip per thread.
+		// </summary>
+		public static void StopAll (Inferior[] inferiors, bool[] stopped, ChildEvent[] events)
+		{
+			IntPtr[] handles = new IntPtr [inferiors.Length];
+			for (int i = 0; i < inferiors.Length; i++) {
+				inferiors [i].check_disposed ();
+				handles [i] = inferiors [i].server_handle;
+			}
+
+			int[] statuses = new int [inferiors.Length];
+			TargetError[] results = new TargetError [inferiors.Length];
+			mono_debugger_server_stop_all (handles, handles.Length, statuses, results);
+
+			for (int i = 0; i < inferiors.Length; i++) {
+				if (results [i] != TargetError.None) {
+					stopped [i] = false;
+					events [i] = null;
+				} else if (statuses [i] == 0) {
+					inferiors [i].target_stopped ();
+					stopped [i] = true;
+					events [i] = null;
+				} else {
+					stopped [i] = true;
+					events [i] = inferiors [i].ProcessEvent (statuses [i]);
+				}
+			}
+		}
+
 		// <summary>
 		//   Just send the inferior a stop signal, but don't wait for it to stop.
 		//   Returns true if it actually sent the signal and false if the target
@@ -1228,8 +1545,10 @@ namespace Mono.Debugger.Backend
 		{
 			check_disposed ();
 			TargetError error = mono_debugger_server_stop (server_handle);
-			if(error == TargetError.AlreadyStopped)
+			if(error == TargetError.AlreadyStopped) {
+				target_stopped ();
 				change_target_state (TargetState.Stopped);
+			}
 			return error == TargetError.None;
 		}
 
@@ -1320,6 +1639,47 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Get the registers of all the @inferiors, which must be stopped, with
+		//   one call into the server.  The entry for an inferior whose registers
+		//   can't be read is null.
+		//
+		//   If @stack_size is non-zero, @stack receives that many bytes from each
+		//   thread's stack pointer, at offset `i * stack_size'; the bytes we
+		//   couldn't read are zero.
+		// </summary>
+		public static Registers[] GetRegisters (Inferior[] inferiors, int stack_size,
+							out byte[] stack)
+		{
+			Registers[] retval = new Registers [inferiors.Length];
+			stack = null;
+			if (inferiors.Length == 0)
+				return retval;
+
+			Architecture arch = inferiors [0].arch;
+			int count = arch.CountRegisters;
+
+			IntPtr[] handles = new IntPtr [inferiors.Length];
+			for (int i = 0; i < inferiors.Length; i++) {
+				inferiors [i].check_disposed ();
+				handles [i] = inferiors [i].server_handle;
+			}
+
+			long[] values = new long [inferiors.Length * count];
+			TargetError[] results = new TargetError [inferiors.Length];
+			stack = new byte [inferiors.Length * stack_size];
+
+			mono_debugger_server_get_registers_multiple (
+				inferiors.Length, handles, count, values, stack_size, stack, results);
+
+			for (int i = 0; i < inferiors.Length; i++) {
+				if (results [i] == TargetError.None)
+					retval [i] = new Registers (arch, values, i * count);
+			}
+
+			return retval;
+		}
+
 		public override void SetRegisters (Registers registers)
 		{
 			IntPtr buffer = IntPtr.Zero;
@@ -1362,6 +1722,19 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Returns the number of threads in the target or -1 if the backend
+		//   can't tell us without reading the whole thread list.
+		// </summary>
+		public int GetThreadCount ()
+		{
+			int count;
+			if (mono_debugger_server_get_thread_count (server_handle, out count) != TargetError.None)
+				return -1;
+
+			return count;
+		}
+
 		protected string GetApplication (out string cwd, out string[] cmdline_args)
 		{
 			IntPtr data = IntPtr.Zero;
@@ -1400,6 +1773,7 @@ namespace Mono.Debugger.Backend
 		public TargetAddress PushRegisters ()
 		{
 			long new_rsp;
+			invalidate_memory_cache ();
 			check_error (mono_debugger_server_push_registers (server_handle, out new_rsp));
 			pushed_regs = true;
 			return new TargetAddress (AddressDomain, new_rsp);
@@ -1608,6 +1982,7 @@ namespace Mono.Debugger.Backend
 
 		protected virtual void OnMemoryChanged ()
 		{
+			invalidate_memory_cache ();
 			// child_event (ChildEventType.CHILD_MEMORY_CHANGED, 0);
 		}
 
@@ -1757,6 +2132,9 @@ namespace Mono.Debugger.Backend
 				// dispose all managed resources.
 				this.disposed = true;
 
+				if (disposing)
+					target_stopped ();
+
 				// Release unmanaged resources
 				lock (this) {
 					if (server_handle != IntPtr.Zero) {
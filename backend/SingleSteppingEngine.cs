@@ -169,7 +169,14 @@ namespace Mono.Debugger.Backend
 			if (inferior == null)
 				return;
 
-			ProcessEvent (inferior.ProcessEvent (status));
+			Inferior.ChildEvent cevent = inferior.ProcessEvent (status);
+			if (cevent.Type == Inferior.ChildEventType.CHILD_RESUMED) {
+				// The server skipped a breakpoint whose condition was false.
+				Report.Debug (DebugFlags.EventLoop, "{0} skipped breakpoint", this);
+				return;
+			}
+
+			ProcessEvent (cevent);
 		}
 
 		public bool ProcessEvent (Inferior.ChildEvent cevent)
@@ -1095,6 +1102,11 @@ namespace Mono.Debugger.Backend
 			if (!bpt.Breaks (thread.ID) || !process.BreakpointManager.IsBreakpointEnabled (index))
 				return false;
 
+			// The server already found the breakpoint's condition to be false, but
+			// couldn't step over the breakpoint itself.
+			if (cevent.Data1 != 0)
+				return false;
+
 			index = bpt.Index;
 
 			bool remain_stopped;
@@ -1138,6 +1150,18 @@ namespace Mono.Debugger.Backend
 			}
 
 			if (instruction.IsIpRelative) {
+				//
+				// Instructions which only use IP-relative addressing for their
+				// operand can still be run out of line after adjusting their
+				// displacement, so the other threads can keep running.
+				//
+				int disp_offset = instruction.DisplacementOffset;
+				if (disp_offset >= 0) {
+					PushOperation (new OperationExecuteInstruction (
+						this, instruction.Code, disp_offset, index, until));
+					return true;
+				}
+
 				PushOperation (new OperationStepOverBreakpoint (this, index, until));
 				return true;
 			}
@@ -1522,6 +1546,23 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Keep stepping while we're inside @frame; the server checks each
+		//   instruction and only reports back once we left the frame or reached
+		//   a call instruction.
+		// </summary>
+		void do_step_range (StepFrame frame)
+		{
+			if (step_over_breakpoint (true, TargetAddress.Null))
+				return;
+
+			if (inferior.IsManagedSignal (inferior.GetPendingSignal ())) {
+				do_continue (inferior.CurrentFrame);
+			} else {
+				inferior.StepRange (frame.Start, frame.End);
+			}
+		}
+
 		protected bool CheckTrampoline (Instruction instruction, TrampolineHandler handler)
 		{
 			TargetAddress trampoline;
@@ -1755,6 +1796,22 @@ namespace Mono.Debugger.Backend
 		}
 
 		internal override void SuspendUserThread ()
+		{
+			if (!BeginSuspendUserThread ())
+				return;
+
+			Inferior.ChildEvent stop_event;
+			bool stopped = inferior.Stop (out stop_event);
+
+			EndSuspendUserThread (stopped, stop_event);
+		}
+
+		// <summary>
+		//   Process.SuspendUserThreads() stops all the threads at once; these are
+		//   the two halves of SuspendUserThread() around the actual stop.
+		//   Returns false if this thread is already stopped.
+		// </summary>
+		internal bool BeginSuspendUserThread ()
 		{
 			if (!ThreadManager.InBackgroundThread)
 				throw new InternalError ();
@@ -1765,12 +1822,11 @@ namespace Mono.Debugger.Backend
 				      "{0} suspend user thread: {1} {2}",
 				      this, engine_stopped, current_operation);
 
-			if (engine_stopped)
-				return;
-
-			Inferior.ChildEvent stop_event;
-			bool stopped = inferior.Stop (out stop_event);
+			return !engine_stopped;
+		}
 
+		internal void EndSuspendUserThread (bool stopped, Inferior.ChildEvent stop_event)
+		{
 			stop_requested = true;
 
 			if (stop_event != null) {
@@ -2146,6 +2202,36 @@ namespace Mono.Debugger.Backend
 			});
 		}
 
+		// <summary>
+		//   Read the registers of all the stopped @engines with one call into the
+		//   server and update their cached registers.  The entry for an engine
+		//   which isn't stopped is null.  Must be called from the engine thread.
+		// </summary>
+		internal static Registers[] GetRegisters (SingleSteppingEngine[] engines)
+		{
+			List<SingleSteppingEngine> stopped = new List<SingleSteppingEngine> ();
+			List<Inferior> inferiors = new List<Inferior> ();
+			foreach (SingleSteppingEngine engine in engines) {
+				if ((engine == null) || (engine.inferior == null) || !engine.engine_stopped)
+					continue;
+				stopped.Add (engine);
+				inferiors.Add (engine.inferior);
+			}
+
+			byte[] stack;
+			Registers[] regs = Inferior.GetRegisters (inferiors.ToArray (), 0, out stack);
+
+			Registers[] retval = new Registers [engines.Length];
+			for (int i = 0; i < stopped.Count; i++) {
+				if (regs [i] == null)
+					continue;
+				stopped [i].registers = regs [i];
+				retval [Array.IndexOf (engines, stopped [i])] = regs [i];
+			}
+
+			return retval;
+		}
+
 		public override void SetRegisters (Registers registers)
 		{
 			if (!registers.FromCurrentFrame)
@@ -2205,6 +2291,13 @@ namespace Mono.Debugger.Backend
 			});
 		}
 
+		public override byte[][] ReadBuffers (TargetAddress[] addresses, int[] sizes)
+		{
+			return (byte[][]) SendCommand (delegate {
+				return inferior.ReadBuffers (addresses, sizes);
+			});
+		}
+
 		public override TargetBlob ReadMemory (TargetAddress address, int size)
 		{
 			return new TargetBlob (ReadBuffer (address, size), TargetMemoryInfo);
@@ -3016,6 +3109,15 @@ namespace Mono.Debugger.Backend
 		}
 	}
 
+	// <summary>
+	//   Activates and deactivates function breakpoints.
+	//
+	//   The runtime needs to be told about each of them with a separate call, but
+	//   we insert and remove the actual breakpoints with one server call each:
+	//   the breakpoints of all the handles we deactivate are removed up front,
+	//   and the ones in methods which are already JIT-compiled are collected and
+	//   inserted once the runtime knows about all the handles.
+	// </summary>
 	protected class OperationActivateBreakpoints : Operation
 	{
 		public OperationActivateBreakpoints (SingleSteppingEngine sse, PendingBreakpointQueue pending)
@@ -3026,6 +3128,7 @@ namespace Mono.Debugger.Backend
 
 		protected override void DoExecute ()
 		{
+			remove_breakpoints ();
 			do_execute ();
 		}
 
@@ -3034,6 +3137,8 @@ namespace Mono.Debugger.Backend
 		}
 
 		PendingBreakpointQueue pending_events;
+		List<KeyValuePair<FunctionBreakpointHandle,Method>> loaded_methods =
+			new List<KeyValuePair<FunctionBreakpointHandle,Method>> ();
 		bool completed;
 
 		protected override EventResult DoProcessEvent (Inferior.ChildEvent cevent,
@@ -3066,6 +3171,7 @@ namespace Mono.Debugger.Backend
 				      inferior.CurrentFrame, pending_events.Count);
 
 			if (pending_events.Count == 0) {
+				insert_breakpoints ();
 				completed = true;
 				return false;
 			}
@@ -3079,22 +3185,88 @@ namespace Mono.Debugger.Backend
 				      "{0} activate breakpoints: {1} {2}", sse, action, handle);
 
 			if (action == BreakpointHandle.Action.Insert)
-				sse.PushOperation (new OperationInsertBreakpoint (sse, handle));
+				sse.PushOperation (new OperationInsertBreakpoint (sse, handle, loaded_methods));
 			else
 				sse.PushOperation (new OperationRemoveBreakpoint (sse, handle));
 			return true;
 		}
+
+		void remove_breakpoints ()
+		{
+			List<BreakpointHandle> handles = new List<BreakpointHandle> ();
+			foreach (var entry in pending_events) {
+				if (entry.Value == BreakpointHandle.Action.Remove)
+					handles.Add (entry.Key);
+			}
+
+			if (handles.Count > 0)
+				inferior.BreakpointManager.RemoveBreakpoints (inferior, handles.ToArray ());
+		}
+
+		void insert_breakpoints ()
+		{
+			TargetAddress[] addresses = new TargetAddress [loaded_methods.Count];
+			Dictionary<int,List<int>> by_domain = new Dictionary<int,List<int>> ();
+
+			for (int i = 0; i < loaded_methods.Count; i++) {
+				var entry = loaded_methods [i];
+				addresses [i] = entry.Key.GetMethodAddress (entry.Value);
+				if (addresses [i].IsNull)
+					continue;
+
+				List<int> list;
+				if (!by_domain.TryGetValue (entry.Value.Domain, out list)) {
+					list = new List<int> ();
+					by_domain.Add (entry.Value.Domain, list);
+				}
+				list.Add (i);
+			}
+
+			foreach (var domain in by_domain) {
+				List<int> list = domain.Value;
+				BreakpointHandle[] handles = new BreakpointHandle [list.Count];
+				TargetAddress[] domain_addresses = new TargetAddress [list.Count];
+				for (int i = 0; i < list.Count; i++) {
+					handles [i] = loaded_methods [list [i]].Key;
+					domain_addresses [i] = addresses [list [i]];
+				}
+
+				Report.Debug (DebugFlags.SSE,
+					      "{0} activate breakpoints: inserting {1} breakpoints in domain {2}",
+					      sse, handles.Length, domain.Key);
+
+				TargetException[] errors = inferior.BreakpointManager.InsertBreakpoints (
+					inferior, handles, domain_addresses, domain.Key);
+
+				for (int i = 0; i < handles.Length; i++) {
+					if (errors [i] != null)
+						Report.Error ("Can't insert breakpoint {0} at {1}: {2}",
+							      handles [i].Breakpoint.Index, domain_addresses [i],
+							      errors [i].Message);
+				}
+			}
+
+			loaded_methods.Clear ();
+		}
 	}
 
 	protected class OperationInsertBreakpoint : OperationCallback
 	{
 		public readonly FunctionBreakpointHandle Handle;
 
+		// <summary>
+		//   If the method is already JIT-compiled, we add it here instead of
+		//   inserting the breakpoint; see OperationActivateBreakpoints.
+		// </summary>
+		List<KeyValuePair<FunctionBreakpointHandle,Method>> loaded_methods;
+
 		public OperationInsertBreakpoint (SingleSteppingEngine sse,
-						  FunctionBreakpointHandle handle)
+						  FunctionBreakpointHandle handle,
+						  List<KeyValuePair<FunctionBreakpointHandle,Method>> loaded_methods)
 			: base (sse, null)
 		{
 			this.Handle = handle;
+			this.loaded_methods = loaded_methods;
 		}
 
 		protected override void DoExecute ()
@@ -3119,7 +3291,15 @@ namespace Mono.Debugger.Backend
 
 			Report.Debug (DebugFlags.SSE, "{0} insert breakpoint done: {1}", sse, info);
 
-			sse.Process.MonoLanguage.RegisterMethodLoadHandler (inferior, info, Handle.Index, Handle.MethodLoaded);
+			MethodLoadedHandler handler = Handle.MethodLoaded;
+			if (!info.IsNull) {
+				handler = delegate (TargetAccess target, Method method) {
+					loaded_methods.Add (new KeyValuePair<FunctionBreakpointHandle,Method> (
+						Handle, method));
+				};
+			}
+
+			sse.Process.MonoLanguage.RegisterMethodLoadHandler (inferior, info, Handle.Index, handler);
 
 			Handle.Breakpoint.OnBreakpointBound ();
 			args = null;
@@ -3147,8 +3327,8 @@ namespace Mono.Debugger.Backend
 			Report.Debug (DebugFlags.SSE,
 				      "{0} remove breakpoint: {1} {2}", sse, Handle, Handle.Index);
 
+			// OperationActivateBreakpoints already removed the breakpoints.
 			sse.Process.MonoLanguage.RemoveMethodLoadHandler (Handle.Index);
-			inferior.BreakpointManager.RemoveBreakpoint (inferior, Handle);
 			inferior.CallMethod (info.RemoveBreakpoint, Handle.Index, 0, ID);
 		}
 
@@ -3325,6 +3505,16 @@ namespace Mono.Debugger.Backend
 		public readonly byte[] Instruction;
 		public readonly bool UpdateIP;
 
+		// <summary>
+		//   For displaced stepping over breakpoint `BreakpointIndex': the offset of
+		//   the IP-relative displacement in `Instruction' or -1.  If we need to
+		//   step over the breakpoint in place after all, we continue to `Until'
+		//   like step_over_breakpoint() would have.
+		// </summary>
+		public readonly int DisplacementOffset = -1;
+		public readonly int BreakpointIndex;
+		public readonly TargetAddress Until = TargetAddress.Null;
+
 		bool pushed_code_buffer;
 
 		public OperationExecuteInstruction (SingleSteppingEngine sse, byte[] insn,
@@ -3335,6 +3525,16 @@ namespace Mono.Debugger.Backend
 			this.UpdateIP = update_ip;
 		}
 
+		public OperationExecuteInstruction (SingleSteppingEngine sse, byte[] insn,
+						    int disp_offset, int breakpoint_index,
+						    TargetAddress until)
+			: this (sse, insn, true)
+		{
+			this.DisplacementOffset = disp_offset;
+			this.BreakpointIndex = breakpoint_index;
+			this.Until = until;
+		}
+
 		public override bool IsSourceOperation {
 			get { return false; }
 		}
@@ -3351,7 +3551,29 @@ namespace Mono.Debugger.Backend
 				return;
 			}
 
-			inferior.ExecuteInstruction (Instruction, UpdateIP);
+			execute_instruction ();
+		}
+
+		void execute_instruction ()
+		{
+			if (DisplacementOffset < 0) {
+				inferior.ExecuteInstruction (Instruction, UpdateIP);
+				return;
+			}
+
+			if (inferior.ExecuteDisplacedInstruction (Instruction, DisplacementOffset))
+				return;
+
+			//
+			// The code buffer is too far away from the instruction's operand, so
+			// we need to step over the breakpoint in place after all.
+			//
+			Report.Debug (DebugFlags.SSE,
+				      "{0} cannot displace instruction at {1}", sse,
+				      inferior.CurrentFrame);
+
+			sse.PushOperation (new OperationStepOverBreakpoint (
+				sse, BreakpointIndex, Until));
 		}
 
 		protected override EventResult DoProcessEvent (Inferior.ChildEvent cevent,
@@ -3365,7 +3587,7 @@ namespace Mono.Debugger.Backend
 			args = null;
 			if (pushed_code_buffer) {
 				pushed_code_buffer = false;
-				inferior.ExecuteInstruction (Instruction, UpdateIP);
+				execute_instruction ();
 				return EventResult.Running;
 			}
 
@@ -3645,7 +3867,10 @@ namespace Mono.Debugger.Backend
 			Instruction instruction = inferior.Architecture.ReadInstruction (
 				inferior, current_frame);
 			if ((instruction == null) || !instruction.IsCall) {
-				sse.do_step ();
+				if (in_frame)
+					sse.do_step_range (StepFrame);
+				else
+					sse.do_step ();
 				return false;
 			}
 
@@ -0,0 +1,134 @@
+using System;
+using System.Collections.Generic;
+using ST = System.Threading;
+
+namespace Mono.Debugger.Backend
+{
+	// <summary>
+	//   Loads symbol files on a small pool of worker threads.
+	//
+	//   Each module which needs its symbols read queues a Job; a Job is also
+	//   the module's readiness event: SymbolFile accessors and address lookups
+	//   which need a module's symbols call Wait() on that module's job only,
+	//   which blocks until a worker has finished it - or runs it right away on
+	//   the calling thread if no worker has picked it up yet.  Everything else
+	//   keeps going while the remaining modules are still being read.
+	//
+	//   Jobs must only touch the disk and their own symbol file; they may not
+	//   access the target.
+	// </summary>
+	internal class SymbolLoadQueue : IDisposable
+	{
+		public static readonly int MaxWorkers = Math.Min (Environment.ProcessorCount, 4);
+
+		Queue<Job> queue = new Queue<Job> ();
+		int num_workers;
+		bool disposed;
+
+		public void Queue (Job job)
+		{
+			lock (this) {
+				if (disposed || (MaxWorkers < 2))
+					return;
+
+				queue.Enqueue (job);
+				if ((num_workers < MaxWorkers) && (num_workers < queue.Count)) {
+					ST.Thread thread = new ST.Thread (new ST.ThreadStart (worker_main));
+					thread.IsBackground = true;
+					thread.Start ();
+					num_workers++;
+				}
+			}
+		}
+
+		void worker_main ()
+		{
+			while (true) {
+				Job job;
+				lock (this) {
+					if (disposed || (queue.Count == 0)) {
+						num_workers--;
+						return;
+					}
+					job = queue.Dequeue ();
+				}
+
+				job.Run (false);
+			}
+		}
+
+		public abstract class Job
+		{
+			bool running, completed;
+
+			// <summary>
+			//   Does the actual work.  Exceptions must be caught and
+			//   remembered by the job itself.
+			// </summary>
+			protected abstract void DoRun ();
+
+			public bool IsCompleted {
+				get {
+					lock (this) {
+						return completed;
+					}
+				}
+			}
+
+			// <summary>
+			//   Blocks until the job is completed.
+			// </summary>
+			public void Wait ()
+			{
+				Run (true);
+			}
+
+			internal void Run (bool wait)
+			{
+				lock (this) {
+					if (running) {
+						while (wait && !completed)
+							ST.Monitor.Wait (this);
+						return;
+					}
+
+					running = true;
+				}
+
+				try {
+					DoRun ();
+				} finally {
+					lock (this) {
+						completed = true;
+						ST.Monitor.PulseAll (this);
+					}
+				}
+			}
+
+			public override string ToString ()
+			{
+				return String.Format ("{0} ({1}:{2})", GetType (), running, completed);
+			}
+		}
+
+		//
+		// IDisposable
+		//
+
+		public void Dispose ()
+		{
+			lock (this) {
+				if (disposed)
+					return;
+
+				//
+				// Workers finish the job they're currently running and then
+				// exit; anything which is still queued runs on demand when
+				// somebody waits for it.
+				//
+				disposed = true;
+				queue.Clear ();
+			}
+		}
+	}
+}
@@ -1,5 +1,6 @@
 using System;
 using System.Collections;
+using System.Collections.Generic;
 using ST = System.Threading;
 using System.Runtime.InteropServices;
 
@@ -14,14 +15,164 @@ namespace Mono.Debugger.Backend
 	{
 		ArrayList symbol_files;
 
+		// <summary>
+		//   All the address ranges from the symbol tables of all our symbol files,
+		//   sorted by start address.  MaxEnd is the largest end address of this
+		//   and all the preceding entries, so we know when to stop searching
+		//   backwards for a range containing an address.
+		//
+		//   This is rebuilt lazily when a symbol file is added or changed; new JIT
+		//   ranges are inserted as they're added by the MonoSymbolFile.
+		// </summary>
+		List<RangeIndexEntry> range_index;
+
+		// <summary>
+		//   Symbol tables which don't have any ranges; they're searched linearly.
+		// </summary>
+		ArrayList unindexed_symtabs;
+
+		// <summary>
+		//   Symbol files which are still being read in the background; they're
+		//   added to the index once they're loaded.
+		// </summary>
+		List<SymbolFile> pending_symfiles;
+
+		SymbolLoadQueue load_queue;
+
+		struct RangeIndexEntry
+		{
+			public readonly long Start;
+			public readonly long End;
+			public readonly ISymbolRange Range;
+			public long MaxEnd;
+
+			public RangeIndexEntry (ISymbolRange range)
+			{
+				this.Range = range;
+				this.Start = range.StartAddress.Address;
+				this.End = range.EndAddress.Address;
+				this.MaxEnd = End;
+			}
+		}
+
 		internal SymbolTableManager (DebuggerSession session)
 		{
 			this.symbol_files = ArrayList.Synchronized (new ArrayList ());
+			this.load_queue = new SymbolLoadQueue ();
+		}
+
+		internal SymbolLoadQueue LoadQueue {
+			get { return load_queue; }
 		}
 
 		internal void AddSymbolFile (SymbolFile symfile)
 		{
 			symbol_files.Add (symfile);
+			SymbolFileChanged (symfile);
+		}
+
+		// <summary>
+		//   Must be called when a symbol file loaded or unloaded its symbol table.
+		//   This may be called from a SymbolLoadQueue worker.
+		// </summary>
+		internal void SymbolFileChanged (SymbolFile symfile)
+		{
+			lock (this) {
+				range_index = null;
+				unindexed_symtabs = null;
+				pending_symfiles = null;
+			}
+		}
+
+		// <summary>
+		//   Called by the MonoSymbolFile when a method has been JIT-compiled.
+		// </summary>
+		internal void AddSymbolRange (ISymbolRange range)
+		{
+			lock (this) {
+				if (range_index == null)
+					return;
+
+				RangeIndexEntry entry = new RangeIndexEntry (range);
+				int pos = upper_bound (entry.Start);
+				range_index.Insert (pos, entry);
+				update_max_end (pos, true);
+			}
+		}
+
+		void build_range_index ()
+		{
+			range_index = new List<RangeIndexEntry> ();
+			unindexed_symtabs = new ArrayList ();
+			pending_symfiles = new List<SymbolFile> ();
+
+			foreach (SymbolFile symfile in symbol_files.ToArray ()) {
+				if (symfile.SymbolsPending) {
+					pending_symfiles.Add (symfile);
+					continue;
+				}
+
+				if (!symfile.SymbolsLoaded)
+					continue;
+
+				ISymbolTable symtab = symfile.SymbolTable;
+				if (symtab == null)
+					continue;
+
+				if (!symtab.HasRanges) {
+					unindexed_symtabs.Add (symtab);
+					continue;
+				}
+
+				ISymbolRange[] ranges = symtab.SymbolRanges;
+				if (ranges == null)
+					continue;
+
+				foreach (ISymbolRange range in ranges)
+					range_index.Add (new RangeIndexEntry (range));
+			}
+
+			range_index.Sort (delegate (RangeIndexEntry a, RangeIndexEntry b) {
+				return a.Start.CompareTo (b.Start);
+			});
+			update_max_end (0, false);
+		}
+
+		// <summary>
+		//   Recompute MaxEnd for all entries starting at @pos.  When inserting
+		//   a single entry, we can stop as soon as an entry's value doesn't
+		//   change anymore.
+		// </summary>
+		void update_max_end (int pos, bool insert)
+		{
+			for (int i = pos; i < range_index.Count; i++) {
+				RangeIndexEntry entry = range_index [i];
+				long max_end = entry.End;
+				if ((i > 0) && (range_index [i - 1].MaxEnd > max_end))
+					max_end = range_index [i - 1].MaxEnd;
+				if (insert && (i > pos) && (entry.MaxEnd == max_end))
+					break;
+				entry.MaxEnd = max_end;
+				range_index [i] = entry;
+			}
+		}
+
+		// <summary>
+		//   Returns the index of the first range which starts after @address.
+		// </summary>
+		int upper_bound (long address)
+		{
+			int lo = 0, hi = range_index.Count;
+
+			while (lo < hi) {
+				int mid = lo + (hi - lo) / 2;
+				if (range_index [mid].Start <= address)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+
+			return lo;
 		}
 
 		//
@@ -30,11 +181,37 @@ namespace Mono.Debugger.Backend
 
 		public Method Lookup (TargetAddress address)
 		{
-			foreach (SymbolFile symfile in symbol_files) {
-				if (!symfile.SymbolsLoaded)
-					continue;
+			ArrayList symtabs;
+
+			//
+			// If the address is inside a module whose symbols are still being
+			// read, wait for just that module.  This must not hold our lock
+			// since the module calls SymbolFileChanged() when it's done.
+			//
+			wait_for_pending (address);
+
+			lock (this) {
+				if (range_index == null)
+					build_range_index ();
+
+				long addr = address.Address;
+				for (int i = upper_bound (addr) - 1; i >= 0; i--) {
+					RangeIndexEntry entry = range_index [i];
+					if (entry.MaxEnd <= addr)
+						break;
+					if (addr >= entry.End)
+						continue;
+
+					Method method = entry.Range.SymbolLookup.Lookup (address);
+					if (method != null)
+						return method;
+				}
 
-				Method method = symfile.SymbolTable.Lookup (address);
+				symtabs = unindexed_symtabs;
+			}
+
+			foreach (ISymbolTable symtab in symtabs) {
+				Method method = symtab.Lookup (address);
 				if (method != null)
 					return method;
 			}
@@ -42,6 +219,23 @@ namespace Mono.Debugger.Backend
 			return null;
 		}
 
+		void wait_for_pending (TargetAddress address)
+		{
+			SymbolFile[] pending;
+			lock (this) {
+				if (range_index == null)
+					build_range_index ();
+				if (pending_symfiles.Count == 0)
+					return;
+				pending = pending_symfiles.ToArray ();
+			}
+
+			foreach (SymbolFile symfile in pending) {
+				if (symfile.CoversAddress (address))
+					symfile.WaitForSymbols ();
+			}
+		}
+
 		public Symbol SimpleLookup (TargetAddress address, bool exact_match)
 		{
 			foreach (SymbolFile symfile in symbol_files) {
@@ -115,6 +309,12 @@ namespace Mono.Debugger.Backend
 			if (!this.disposed) {
 				if (disposing) {
 					symbol_files = ArrayList.Synchronized (new ArrayList ());
+					lock (this) {
+						range_index = null;
+						unindexed_symtabs = null;
+						pending_symfiles = null;
+					}
+					load_queue.Dispose ();
 				}
 				
 				this.disposed = true;
@@ -46,6 +46,21 @@ namespace Mono.Debugger
 
 		public abstract byte[] ReadBuffer (TargetAddress address, int size);
 
+		//
+		// Read several memory regions at once; the default implementation just calls
+		// ReadBuffer() for each of them, backends may override this to do it in one go.
+		//
+		public virtual byte[][] ReadBuffers (TargetAddress[] addresses, int[] sizes)
+		{
+			if (addresses.Length != sizes.Length)
+				throw new ArgumentException ();
+
+			byte[][] retval = new byte [addresses.Length][];
+			for (int i = 0; i < addresses.Length; i++)
+				retval [i] = ReadBuffer (addresses [i], sizes [i]);
+			return retval;
+		}
+
 		public abstract Registers GetRegisters ();
 
 		public abstract bool CanWrite {
@@ -0,0 +1,192 @@
+using System;
+using System.Collections.Generic;
+
+namespace Mono.Debugger.Backend
+{
+	// <summary>
+	//   Page-granular cache for target memory which is shared between all the
+	//   threads of a process.
+	//
+	//   While all threads are stopped, the target's memory can only change through
+	//   our own writes, so we can keep the pages around until one of the threads is
+	//   resumed or we write to the target.  As soon as any thread is running, all
+	//   reads go directly to the target.
+	// </summary>
+	internal class TargetMemoryCache
+	{
+		public const int PageSize = 4096;
+
+		// <summary>
+		//   Don't let the cache grow without bound; we just throw everything away
+		//   when it's full.
+		// </summary>
+		public const int MaxPages = 1024;
+
+		// <summary>
+		//   Larger reads bypass the cache; so do ReadBuffers() calls with more
+		//   than MaxPages / 2 regions, so they always fit into it.
+		// </summary>
+		public const int MaxCachedRead = 16 * PageSize;
+
+		Dictionary<long,byte[]> pages = new Dictionary<long,byte[]> ();
+		int running_threads;
+		long hits, misses;
+
+		public long Hits {
+			get { return hits; }
+		}
+
+		public long Misses {
+			get { return misses; }
+		}
+
+		public bool IsValid {
+			get { return running_threads == 0; }
+		}
+
+		public void ThreadResumed ()
+		{
+			lock (this) {
+				running_threads++;
+				pages.Clear ();
+			}
+		}
+
+		public void ThreadStopped ()
+		{
+			lock (this) {
+				if (running_threads > 0)
+					running_threads--;
+			}
+		}
+
+		public void Invalidate ()
+		{
+			lock (this) {
+				pages.Clear ();
+			}
+		}
+
+		public byte[] ReadBuffer (Inferior inferior, TargetAddress address, int size)
+		{
+			lock (this) {
+				if ((running_threads > 0) || (size > MaxCachedRead))
+					return inferior.ReadBufferUncached (address, size);
+
+				long start = address.Address;
+				try {
+					fill_pages (inferior, new long[] { start }, new int[] { size });
+					return copy_from_pages (start, size);
+				} catch (TargetMemoryException) {
+					//
+					// The whole page may not be readable (for instance at the end
+					// of a mapping) even though the requested range is; let the
+					// target decide.
+					//
+					return inferior.ReadBufferUncached (address, size);
+				}
+			}
+		}
+
+		public byte[][] ReadBuffers (Inferior inferior, TargetAddress[] addresses, int[] sizes)
+		{
+			lock (this) {
+				int total_size = 0;
+				foreach (int size in sizes)
+					total_size += size;
+
+				if ((running_threads > 0) || (total_size > MaxCachedRead) ||
+				    (addresses.Length > MaxPages / 2))
+					return inferior.ReadBuffersUncached (addresses, sizes);
+
+				long[] starts = new long [addresses.Length];
+				for (int i = 0; i < addresses.Length; i++)
+					starts [i] = addresses [i].Address;
+
+				byte[][] retval = new byte [addresses.Length][];
+				try {
+					fill_pages (inferior, starts, sizes);
+					for (int i = 0; i < addresses.Length; i++)
+						retval [i] = copy_from_pages (starts [i], sizes [i]);
+				} catch (TargetMemoryException) {
+					return inferior.ReadBuffersUncached (addresses, sizes);
+				}
+
+				return retval;
+			}
+		}
+
+		byte[] copy_from_pages (long start, int size)
+		{
+			byte[] retval = new byte [size];
+
+			int offset = 0;
+			while (offset < size) {
+				long page = (start + offset) & ~((long) PageSize - 1);
+				int page_offset = (int) (start + offset - page);
+				int count = Math.Min (PageSize - page_offset, size - offset);
+
+				Array.Copy (pages [page], page_offset, retval, offset, count);
+				offset += count;
+			}
+
+			return retval;
+		}
+
+		// <summary>
+		//   Make sure that all the pages covering the given regions are in the
+		//   cache.  The missing ones are read from the target at once.
+		// </summary>
+		void fill_pages (Inferior inferior, long[] starts, int[] sizes)
+		{
+			List<long> needed = new List<long> ();
+			for (int i = 0; i < starts.Length; i++) {
+				if (sizes [i] == 0)
+					continue;
+
+				long first = starts [i] & ~((long) PageSize - 1);
+				long last = (starts [i] + sizes [i] - 1) & ~((long) PageSize - 1);
+				for (long page = first; page <= last; page += PageSize) {
+					if (!needed.Contains (page))
+						needed.Add (page);
+				}
+			}
+
+			if (pages.Count + needed.Count > MaxPages)
+				pages.Clear ();
+
+			List<TargetAddress> missing = new List<TargetAddress> ();
+			foreach (long page in needed) {
+				if (pages.ContainsKey (page))
+					hits++;
+				else
+					missing.Add (new TargetAddress (inferior.AddressDomain, page));
+			}
+
+			if (missing.Count == 0)
+				return;
+
+			misses += missing.Count;
+
+			if (missing.Count == 1) {
+				pages.Add (missing [0].Address, inferior.ReadBufferUncached (
+					missing [0], PageSize));
+				return;
+			}
+
+			int[] page_sizes = new int [missing.Count];
+			for (int i = 0; i < page_sizes.Length; i++)
+				page_sizes [i] = PageSize;
+
+			byte[][] contents = inferior.ReadBuffersUncached (missing.ToArray (), page_sizes);
+			for (int i = 0; i < contents.Length; i++)
+				pages.Add (missing [i].Address, contents [i]);
+		}
+
+		public override string ToString ()
+		{
+			return String.Format ("TargetMemoryCache ({0}:{1}:{2}:{3})",
+					      pages.Count, running_threads, hits, misses);
+		}
+	}
+}
@@ -9,23 +9,23 @@ namespace Mono.Debugger.Backend
 	[Serializable]
 	internal class TargetReader
 	{
-		byte[] data;
+		TargetBlob blob;
 		TargetBinaryReader reader;
 		TargetMemoryInfo info;
 
 		internal TargetReader (byte[] data, TargetMemoryInfo info)
+			: this (new TargetBlob (data, info))
+		{ }
+
+		internal TargetReader (TargetBlob blob)
 		{
-			if ((info == null) || (data == null))
+			if ((blob == null) || (blob.TargetMemoryInfo == null))
 				throw new ArgumentNullException ();
-			this.reader = new TargetBinaryReader (data, info);
-			this.info = info;
-			this.data = data;
+			this.reader = new TargetBinaryReader (blob);
+			this.info = blob.TargetMemoryInfo;
+			this.blob = blob;
 		}
 
-		internal TargetReader (TargetBlob data)
-			: this (data.Contents, data.TargetMemoryInfo)
-		{ }
-
 		public long Offset {
 			get {
 				return reader.Position;
@@ -38,13 +38,13 @@ namespace Mono.Debugger.Backend
 
 		public long Size {
 			get {
-				return data.Length;
+				return blob.Size;
 			}
 		}
 
 		public byte[] Contents {
 			get {
-				return data;
+				return blob.Contents;
 			}
 		}
 
@@ -212,7 +212,7 @@ namespace Mono.Debugger.Backend
 
 		public override string ToString ()
 		{
-			return String.Format ("MemoryReader ([{0}])", TargetBinaryReader.HexDump (data));
+			return String.Format ("MemoryReader ([{0}])", TargetBinaryReader.HexDump (blob.Contents));
 		}
 	}
 }
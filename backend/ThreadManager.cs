@@ -82,6 +82,9 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		static extern int mono_debugger_server_global_wait (out int status);
 
+		[DllImport("monodebuggerserver")]
+		static extern int mono_debugger_server_global_poll (out int status);
+
 		[DllImport("monodebuggerserver")]
 		static extern Inferior.ChildEventType mono_debugger_server_dispatch_simple (int status, out int arg);
 
@@ -325,24 +328,11 @@ namespace Mono.Debugger.Backend
 			current_command = null;
 
 			if (event_engine != null) {
-				try {
-					Report.Debug (DebugFlags.Wait,
-						      "ThreadManager {0} process event: {1}",
-						      DebuggerWaitHandle.CurrentThread, event_engine);
-					event_engine.ProcessEvent (status);
-					Report.Debug (DebugFlags.Wait,
-						      "ThreadManager {0} process event done: {1}",
-						      DebuggerWaitHandle.CurrentThread, event_engine);
-				} catch (ST.ThreadAbortException) {
-					;
-				} catch (Exception e) {
-					Report.Debug (DebugFlags.Wait,
-						      "ThreadManager caught exception: {0}", e);
-					Console.WriteLine ("EXCEPTION: {0}", e);
-				}
-
+				process_event (event_engine, status);
 				check_pending_events ();
 
+				process_ready_events ();
+
 				if (command == null)
 					engine_event.Set ();
 				RequestWait ();
@@ -390,6 +380,61 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		void process_event (SingleSteppingEngine event_engine, int status)
+		{
+			try {
+				Report.Debug (DebugFlags.Wait,
+					      "ThreadManager {0} process event: {1}",
+					      DebuggerWaitHandle.CurrentThread, event_engine);
+				event_engine.ProcessEvent (status);
+				Report.Debug (DebugFlags.Wait,
+					      "ThreadManager {0} process event done: {1}",
+					      DebuggerWaitHandle.CurrentThread, event_engine);
+			} catch (ST.ThreadAbortException) {
+				;
+			} catch (Exception e) {
+				Report.Debug (DebugFlags.Wait,
+					      "ThreadManager caught exception: {0}", e);
+				Console.WriteLine ("EXCEPTION: {0}", e);
+			}
+		}
+
+		// <summary>
+		//   Maximum number of additional events we process in one wake-up of the
+		//   engine thread before looking at the command queue again.
+		// </summary>
+		const int MaxEventBatch = 256;
+
+		// <summary>
+		//   When many threads stop at the same time (for instance because they
+		//   all hit the same breakpoint), we don't want to go through the wait
+		//   thread for each of them.  The wait thread is idle while we're
+		//   processing an event, so we can just pick up everything which is
+		//   already waiting to be reaped right here.
+		// </summary>
+		void process_ready_events ()
+		{
+			if (!Inferior.HasThreadEvents)
+				return;
+
+			for (int i = 0; (i < MaxEventBatch) && !abort_requested; i++) {
+				int status;
+				int pid = mono_debugger_server_global_poll (out status);
+				if (pid <= 0)
+					return;
+
+				Report.Debug (DebugFlags.Wait,
+					      "ThreadManager polled event: {0} {1:x}", pid, status);
+
+				SingleSteppingEngine event_engine = get_event_engine (pid, status);
+				if (event_engine == null)
+					continue;
+
+				process_event (event_engine, status);
+				check_pending_events ();
+			}
+		}
+
 		void check_pending_events ()
 		{
 			SingleSteppingEngine[] list = new SingleSteppingEngine [pending_events.Count];
@@ -541,65 +586,23 @@ namespace Mono.Debugger.Backend
 					goto again;
 				}
 
-				ArrayList check_threads = new ArrayList();
-				bool got_threads = true;
-				foreach(Process process in processes)
-					got_threads = got_threads && process.CheckForThreads(check_threads);
-
-				if(got_threads) {
-					int[] lwps = new int [thread_hash.Count];
-					thread_hash.Keys.CopyTo (lwps, 0);
-					foreach(int lwp in lwps) {
-						if(!check_threads.Contains(lwp)) {
-							SingleSteppingEngine old_engine = (SingleSteppingEngine) thread_hash [lwp];					
-							thread_hash.Remove (old_engine.PID);
-							engine_hash.Remove (old_engine.ID);
-							old_engine.Process.OnThreadExitedEvent (old_engine);
-							old_engine.Dispose ();
-						}
+				foreach (Process process in processes.ToArray ()) {
+					SingleSteppingEngine[] exited = process.CheckForExitedThreads ();
+					if (exited == null)
+						continue;
+
+					foreach (SingleSteppingEngine old_engine in exited) {
+						thread_hash.Remove (old_engine.PID);
+						engine_hash.Remove (old_engine.ID);
+						old_engine.Process.OnThreadExitedEvent (old_engine);
+						old_engine.Dispose ();
 					}
 				}
 			}
 
-			SingleSteppingEngine event_engine = (SingleSteppingEngine) thread_hash [pid];
-			if (event_engine == null && Inferior.HasThreadEvents) {
-				int arg;
-				Inferior.ChildEventType etype = mono_debugger_server_dispatch_simple (status, out arg);
-
-				/*
-				 * Ignore exit events from unknown children.
-				 */
-
-				if ((etype == Inferior.ChildEventType.CHILD_EXITED) && (arg == 0))
-					goto again;
-
-				/*
-				 * There is a race condition in the Linux kernel which shows up on >= 2.6.27:
-				 *
-				 * When creating a new thread, the initial stopping event of that thread is sometimes
-				 * sent before sending the `PTRACE_EVENT_CLONE' for it.
-				 *
-				 * Because of this, we explicitly wait for the new thread to stop and ignore any
-				 * "early" stopping signals.
-				 *
-				 * See also the comments in _server_ptrace_wait_for_new_thread() in x86-linux-ptrace.c
-				 * and bugs #423518 and #466012.
-				 *
-				 */
-
-				if ((etype != Inferior.ChildEventType.CHILD_STOPPED) || (arg != 0)) {
-					Report.Error ("WARNING: Got event {0:x} for unknown pid {1}", status, pid);
-					waiting = false;
-					RequestWait ();
-					return true;
-				}
-
-				if (!pending_sigstops.ContainsKey (pid))
-					pending_sigstops.Add (pid, DateTime.Now);
-
-				Report.Debug (DebugFlags.Wait, "Ignoring SIGSTOP from unknown pid {0}.", pid);
+			SingleSteppingEngine event_engine = get_event_engine (pid, status);
+			if (event_engine == null)
 				goto again;
-			}
 
 			engine_event.WaitOne ();
 
@@ -621,6 +624,52 @@ namespace Mono.Debugger.Backend
 			return true;
 		}
 
+		// <summary>
+		//   Returns the engine for an event we got from the target or null if the
+		//   event should be ignored.
+		// </summary>
+		SingleSteppingEngine get_event_engine (int pid, int status)
+		{
+			SingleSteppingEngine event_engine = (SingleSteppingEngine) thread_hash [pid];
+			if ((event_engine != null) || !Inferior.HasThreadEvents)
+				return event_engine;
+
+			int arg;
+			Inferior.ChildEventType etype = mono_debugger_server_dispatch_simple (status, out arg);
+
+			/*
+			 * Ignore exit events from unknown children.
+			 */
+
+			if ((etype == Inferior.ChildEventType.CHILD_EXITED) && (arg == 0))
+				return null;
+
+			/*
+			 * There is a race condition in the Linux kernel which shows up on >= 2.6.27:
+			 *
+			 * When creating a new thread, the initial stopping event of that thread is sometimes
+			 * sent before sending the `PTRACE_EVENT_CLONE' for it.
+			 *
+			 * Because of this, we explicitly wait for the new thread to stop and ignore any
+			 * "early" stopping signals.
+			 *
+			 * See also the comments in _server_ptrace_wait_for_new_thread() in x86-linux-ptrace.c
+			 * and bugs #423518 and #466012.
+			 *
+			 */
+
+			if ((etype != Inferior.ChildEventType.CHILD_STOPPED) || (arg != 0)) {
+				Report.Error ("WARNING: Got event {0:x} for unknown pid {1}", status, pid);
+				return null;
+			}
+
+			if (!pending_sigstops.ContainsKey (pid))
+				pending_sigstops.Add (pid, DateTime.Now);
+
+			Report.Debug (DebugFlags.Wait, "Ignoring SIGSTOP from unknown pid {0}.", pid);
+			return null;
+		}
+
 		private void RequestWait ()
 		{
 			if (waiting)
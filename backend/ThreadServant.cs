@@ -264,6 +264,14 @@ namespace Mono.Debugger.Backend
 
 		public abstract byte[] ReadBuffer (TargetAddress address, int size);
 
+		public virtual byte[][] ReadBuffers (TargetAddress[] addresses, int[] sizes)
+		{
+			byte[][] retval = new byte [addresses.Length][];
+			for (int i = 0; i < addresses.Length; i++)
+				retval [i] = ReadBuffer (addresses [i], sizes [i]);
+			return retval;
+		}
+
 		public abstract Registers GetRegisters ();
 
 		public abstract bool CanWrite {
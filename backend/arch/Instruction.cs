@@ -39,6 +39,15 @@ namespace Mono.Debugger.Architectures
 			get;
 		}
 
+		// <summary>
+		//   If this is an IP-relative instruction which can be run out of line
+		//   after adjusting its 32-bit displacement, the offset of that
+		//   displacement within `Code'; -1 otherwise.
+		// </summary>
+		public abstract int DisplacementOffset {
+			get;
+		}
+
 		public bool IsCall {
 			get {
 				return (InstructionType == Type.Call) ||
@@ -58,6 +58,19 @@ namespace Mono.Debugger.Architectures
 			}
 		}
 
+		public override int DisplacementOffset {
+			get {
+				if ((type != Type.Unknown) && (type != Type.Interpretable))
+					return -1;
+				if (!is_ip_relative || !has_insn_size)
+					return -1;
+				if ((displacement_offset < 0) || (displacement_offset + 4 > insn_size))
+					return -1;
+
+				return displacement_offset;
+			}
+		}
+
 		public override bool HasInstructionSize {
 			get { return has_insn_size; }
 		}
@@ -81,6 +94,7 @@ namespace Mono.Debugger.Architectures
 		}
 
 		bool is_ip_relative;
+		int displacement_offset = -1;
 		bool has_insn_size;
 		int insn_size;
 		byte[] code;
@@ -292,6 +306,8 @@ namespace Mono.Debugger.Architectures
 			ModRM = new X86_ModRM (this, reader.ReadByte ());
 
 			if (Is64BitMode && (ModRM.Mod == 0) && ((ModRM.R_M & 0x07) == 0x05)) {
+				/* The 32-bit displacement immediately follows the ModRM byte. */
+				displacement_offset = (int) reader.Offset;
 				is_ip_relative = true;
 			}
 		}
@@ -347,6 +363,13 @@ namespace Mono.Debugger.Architectures
 			if (TwoByte_Has_ModRM [opcode] != 0)
 				DecodeModRM (reader);
 
+			/*
+			 * Three-byte opcodes have their ModRM byte one byte later, so we
+			 * don't know where their displacement is.
+			 */
+			if ((opcode == 0x38) || (opcode == 0x3a))
+				displacement_offset = -1;
+
 			if ((opcode >= 0x80) && (opcode <= 0x8f)) {
 				if ((RexPrefix & X86_REX_Prefix.REX_W) != 0) {
 					long offset = reader.BinaryReader.ReadInt32 ();
@@ -504,6 +527,13 @@ namespace Mono.Debugger.Architectures
 			else
 				OneByteOpcode (reader, opcode);
 
+			/*
+			 * We don't decode VEX, EVEX and XOP prefixes, so we'd look at the
+			 * wrong ModRM byte.
+			 */
+			if ((opcode == 0xc4) || (opcode == 0xc5) || (opcode == 0x62) || (opcode == 0x8f))
+				displacement_offset = -1;
+
 			if (InstructionType != Type.Unknown) {
 				insn_size = (int) reader.Offset;
 				has_insn_size = true;
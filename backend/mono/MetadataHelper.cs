@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Generic;
 
 using Mono.Debugger.Backend;
 using Mono.Debugger.Languages;
@@ -53,6 +54,8 @@ namespace Mono.Debugger.Backend.Mono
 		protected readonly MonoDebuggerInfo MonoDebuggerInfo;
 		protected readonly MetadataInfo MonoMetadataInfo;
 
+		Dictionary<long,MonoClassSnapshot> class_cache = new Dictionary<long,MonoClassSnapshot> ();
+
 		protected MetadataHelper (MonoDebuggerInfo info, MetadataInfo metadata)
 		{
 			this.MonoDebuggerInfo = info;
@@ -69,31 +72,142 @@ namespace Mono.Debugger.Backend.Mono
 		// MonoClass
 		//
 
+		// <summary>
+		//   Everything we need to know about a `MonoClass' and its `MonoClassField'
+		//   array, decoded from one read of each.
+		// </summary>
+		public class MonoClassSnapshot
+		{
+			public readonly TargetAddress Klass;
+			public readonly TargetAddress Image;
+			public readonly int Token;
+			public readonly TargetAddress Parent;
+			public readonly TargetAddress GenericClass;
+			public readonly TargetAddress GenericContainer;
+			public readonly int Flags;
+			public readonly int InstanceSize;
+			public readonly int FieldCount;
+			public readonly TargetAddress Fields;
+
+			/* Only valid if `Fields' is not null. */
+			public readonly TargetAddress[] FieldTypes;
+			public readonly int[] FieldOffsets;
+
+			internal MonoClassSnapshot (MetadataHelper helper, TargetMemoryAccess memory,
+						    TargetAddress klass)
+			{
+				MetadataInfo info = helper.MonoMetadataInfo;
+				int addr_size = memory.TargetMemoryInfo.TargetAddressSize;
+
+				Klass = klass;
+
+				TargetReader reader = new TargetReader (memory.ReadMemory (klass, info.KlassSize));
+				Image = reader.PeekAddress (info.KlassImageOffset);
+				Token = reader.PeekInteger (info.KlassTokenOffset);
+				Parent = reader.PeekAddress (info.KlassParentOffset);
+				GenericClass = reader.PeekAddress (info.KlassGenericClassOffset);
+				GenericContainer = reader.PeekAddress (info.KlassGenericContainerOffset);
+				Flags = reader.PeekInteger (4 * addr_size);
+				InstanceSize = reader.PeekInteger (4 + 3 * addr_size);
+				FieldCount = reader.PeekInteger (info.KlassFieldCountOffset);
+				Fields = reader.PeekAddress (info.KlassFieldOffset);
+
+				if (Fields.IsNull)
+					return;
+
+				FieldTypes = new TargetAddress [FieldCount];
+				FieldOffsets = new int [FieldCount];
+				if (FieldCount == 0)
+					return;
+
+				TargetReader field_reader = new TargetReader (
+					memory.ReadMemory (Fields, FieldCount * info.FieldInfoSize));
+				for (int i = 0; i < FieldCount; i++) {
+					int offset = i * info.FieldInfoSize;
+					FieldTypes [i] = field_reader.PeekAddress (
+						offset + info.FieldInfoTypeOffset);
+					FieldOffsets [i] = field_reader.PeekInteger (
+						offset + info.FieldInfoOffsetOffset);
+				}
+			}
+
+			public bool SizeInited {
+				get { return (Flags & 4) != 0; }
+			}
+
+			public bool IsValueType {
+				get { return (Flags & 8) != 0; }
+			}
+
+			public bool HasFields {
+				get { return !Fields.IsNull; }
+			}
+
+			// <summary>
+			//   Once the runtime has initialized a class, none of the fields we
+			//   read change anymore.
+			// </summary>
+			internal bool IsComplete {
+				get { return SizeInited && (HasFields || (FieldCount == 0)); }
+			}
+
+			public override string ToString ()
+			{
+				return String.Format ("MonoClassSnapshot ({0}:{1:x}:{2}:{3})",
+						      Klass, Token, FieldCount, Flags);
+			}
+		}
+
+		// <summary>
+		//   Read the `MonoClass' at @klass and its fields.  We keep the result
+		//   until the next domain unload once the class is fully initialized.
+		// </summary>
+		public MonoClassSnapshot ReadMonoClass (TargetMemoryAccess memory, TargetAddress klass)
+		{
+			MonoClassSnapshot snapshot;
+			lock (class_cache) {
+				if (class_cache.TryGetValue (klass.Address, out snapshot))
+					return snapshot;
+			}
+
+			snapshot = new MonoClassSnapshot (this, memory, klass);
+			if (!snapshot.IsComplete)
+				return snapshot;
+
+			lock (class_cache) {
+				class_cache [klass.Address] = snapshot;
+			}
+			return snapshot;
+		}
+
+		public void FlushClassCache ()
+		{
+			lock (class_cache) {
+				class_cache.Clear ();
+			}
+		}
+
 		public TargetAddress MonoClassGetMonoImage (TargetMemoryAccess memory,
 							    TargetAddress klass)
 		{
-			return memory.ReadAddress (klass + MonoMetadataInfo.KlassImageOffset);
+			return ReadMonoClass (memory, klass).Image;
 		}
 
 		public int MonoClassGetToken (TargetMemoryAccess memory,
 					      TargetAddress klass)
 		{
-			return memory.ReadInteger (klass + MonoMetadataInfo.KlassTokenOffset);
+			return ReadMonoClass (memory, klass).Token;
 		}
 
 		public int MonoClassGetInstanceSize (TargetMemoryAccess memory,
 						     TargetAddress klass)
 		{
-			int flags = memory.ReadInteger (klass + 4 * memory.TargetAddressSize);
-
-			bool size_inited = (flags & 4) != 0;
-			bool valuetype = (flags & 8) != 0;
-
-			if (!size_inited)
+			MonoClassSnapshot snapshot = ReadMonoClass (memory, klass);
+			if (!snapshot.SizeInited)
 				throw new TargetException (TargetError.ClassNotInitialized);
 
-			int size = memory.ReadInteger (klass + 4 + 3 * memory.TargetAddressSize);
-			if (valuetype)
+			int size = snapshot.InstanceSize;
+			if (snapshot.IsValueType)
 				size -= 2 * memory.TargetAddressSize;
 
 			return size;
@@ -102,19 +216,19 @@ namespace Mono.Debugger.Backend.Mono
 		public TargetAddress MonoClassGetParent (TargetMemoryAccess memory,
 							 TargetAddress klass)
 		{
-			return memory.ReadAddress (klass + MonoMetadataInfo.KlassParentOffset);
+			return ReadMonoClass (memory, klass).Parent;
 		}
 
 		public TargetAddress MonoClassGetGenericClass (TargetMemoryAccess memory,
 							       TargetAddress klass)
 		{
-			return memory.ReadAddress (klass + MonoMetadataInfo.KlassGenericClassOffset);
+			return ReadMonoClass (memory, klass).GenericClass;
 		}
 
 		public TargetAddress MonoClassGetGenericContainer (TargetMemoryAccess memory,
 								   TargetAddress klass)
 		{
-			return memory.ReadAddress (klass + MonoMetadataInfo.KlassGenericContainerOffset);
+			return ReadMonoClass (memory, klass).GenericContainer;
 		}
 
 		public TargetAddress MonoClassGetByValType (TargetMemoryAccess memory,
@@ -125,42 +239,32 @@ namespace Mono.Debugger.Backend.Mono
 
 		public bool MonoClassHasFields (TargetMemoryAccess memory, TargetAddress klass)
 		{
-			TargetAddress fields = memory.ReadAddress (
-				klass + MonoMetadataInfo.KlassFieldOffset);
-			return !fields.IsNull;
+			return ReadMonoClass (memory, klass).HasFields;
 		}
 
 		public int MonoClassGetFieldCount (TargetMemoryAccess memory, TargetAddress klass)
 		{
-			return memory.ReadInteger (klass + MonoMetadataInfo.KlassFieldCountOffset);
+			return ReadMonoClass (memory, klass).FieldCount;
 		}
 
 		public TargetAddress MonoClassGetFieldType (TargetMemoryAccess memory, TargetAddress klass,
 							    int index)
 		{
-			int offset = index * MonoMetadataInfo.FieldInfoSize +
-				MonoMetadataInfo.FieldInfoTypeOffset;
-
-			TargetAddress fields = memory.ReadAddress (
-				klass + MonoMetadataInfo.KlassFieldOffset);
-			if (fields.IsNull)
+			MonoClassSnapshot snapshot = ReadMonoClass (memory, klass);
+			if (!snapshot.HasFields)
 				throw new TargetException (TargetError.ClassNotInitialized);
 
-			return memory.ReadAddress (fields + offset);
+			return snapshot.FieldTypes [index];
 		}
 
 		public int MonoClassGetFieldOffset (TargetMemoryAccess memory, TargetAddress klass,
 						    int index)
 		{
-			int offset = index * MonoMetadataInfo.FieldInfoSize +
-				MonoMetadataInfo.FieldInfoOffsetOffset;
-
-			TargetAddress fields = memory.ReadAddress (
-				klass + MonoMetadataInfo.KlassFieldOffset);
-			if (fields.IsNull)
+			MonoClassSnapshot snapshot = ReadMonoClass (memory, klass);
+			if (!snapshot.HasFields)
 				throw new TargetException (TargetError.ClassNotInitialized);
 
-			return memory.ReadInteger (fields + offset);
+			return snapshot.FieldOffsets [index];
 		}
 
 		public bool MonoClassHasMethods (TargetMemoryAccess memory, TargetAddress klass)
@@ -224,6 +224,7 @@ namespace Mono.Debugger.Backend.Mono
 		GlobalDataTable global_data_table;
 
 		MetadataHelper runtime;
+		MonoSymbolFileLoader symfile_loader;
 
 		Process process;
 		MonoDebuggerInfo info;
@@ -235,6 +236,7 @@ namespace Mono.Debugger.Backend.Mono
 			this.process = process;
 			this.info = info;
 			data_tables = new Hashtable ();
+			symfile_loader = new MonoSymbolFileLoader (process);
 		}
 
 		public override string Name {
@@ -684,6 +686,30 @@ namespace Mono.Debugger.Backend.Mono
 				builtin_types = new MonoBuiltinTypeInfo (corlib, memory);
 		}
 
+		internal MonoSymbolFileLoader SymbolFileLoader {
+			get { return symfile_loader; }
+		}
+
+		// <summary>
+		//   Start loading the assembly and symbol file for the MonoDebuggerSymbolFile
+		//   at @address in the background; see MonoSymbolFileLoader.
+		// </summary>
+		void queue_symfile (TargetMemoryAccess memory, TargetAddress address)
+		{
+			if (symfile_hash.Contains (address))
+				return;
+
+			TargetAddress image_file_addr = memory.ReadAddress (
+				address + memory.TargetMemoryInfo.TargetIntegerSize);
+			string image_file = memory.ReadString (image_file_addr);
+
+			string shadow_location = GetShadowCopyLocation (image_file);
+			if (shadow_location != null)
+				image_file = shadow_location;
+
+			symfile_loader.Queue (image_file);
+		}
+
 		MonoSymbolFile load_symfile (TargetMemoryAccess memory, TargetAddress address)
 		{
 			MonoSymbolFile symfile = null;
@@ -767,10 +793,8 @@ namespace Mono.Debugger.Backend.Mono
 
 			if (corlib_address.IsNull)
 				throw new SymbolTableException ("Corlib address is null.");
-			corlib = load_symfile (memory, corlib_address);
-			if (corlib == null)
-				throw new SymbolTableException ("Cannot read corlib!");
 
+			List<TargetAddress> symfiles = new List<TargetAddress> ();
 			TargetAddress ptr = symfile_by_index;
 			while (!ptr.IsNull) {
 				TargetAddress next_ptr = memory.ReadAddress (ptr);
@@ -778,9 +802,26 @@ namespace Mono.Debugger.Backend.Mono
 					ptr + memory.TargetMemoryInfo.TargetAddressSize);
 
 				ptr = next_ptr;
-				load_symfile (memory, address);
+				symfiles.Add (address);
 			}
 
+			//
+			// Get the workers going on all the images before we start
+			// creating the symbol files one by one.  We still create all of
+			// them before returning since the data tables below and the
+			// session's modules need every one of them.
+			//
+			queue_symfile (memory, corlib_address);
+			foreach (TargetAddress address in symfiles)
+				queue_symfile (memory, address);
+
+			corlib = load_symfile (memory, corlib_address);
+			if (corlib == null)
+				throw new SymbolTableException ("Cannot read corlib!");
+
+			foreach (TargetAddress address in symfiles)
+				load_symfile (memory, address);
+
 			ptr = data_table_list;
 			while (!ptr.IsNull) {
 				TargetAddress next_ptr = memory.ReadAddress (ptr);
@@ -1437,6 +1478,7 @@ namespace Mono.Debugger.Backend.Mono
 				Report.Debug (DebugFlags.JitSymtab,
 					      "Domain unload: {0} {1:x}", data, arg);
 				destroy_data_table ((int) arg, data);
+				runtime.FlushClassCache ();
 				engine.Process.BreakpointManager.DomainUnload (inferior, (int) arg);
 				break;
 
@@ -1472,6 +1514,8 @@ namespace Mono.Debugger.Backend.Mono
 			}
 
 			if (disposing) {
+				symfile_loader.Dispose ();
+
 				if (symfile_hash != null) {
 					foreach (MonoSymbolFile symfile in symfile_hash.Values)
 						symfile.Dispose();
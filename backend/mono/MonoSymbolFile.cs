@@ -177,7 +177,6 @@ namespace Mono.Debugger.Backend.Mono
 		internal readonly TargetAddress MonoImage;
 		internal readonly MonoDataTable TypeTable;
 		internal readonly string ImageFile;
-		internal readonly C.MonoSymbolFile File;
 		internal readonly ThreadManager ThreadManager;
 		internal readonly TargetMemoryInfo TargetMemoryInfo;
 		internal readonly MonoLanguageBackend MonoLanguage;
@@ -186,6 +185,9 @@ namespace Mono.Debugger.Backend.Mono
 		MonoSymbolTable symtab;
 		Module module;
 		string name;
+		MonoSymbolFileLoader.SymbolJob symbol_job;
+		C.MonoSymbolFile file;
+		bool file_loaded;
 
 		Hashtable range_hash;
 		ArrayList ranges;
@@ -230,33 +232,17 @@ namespace Mono.Debugger.Backend.Mono
 			if (shadow_location != null)
 				ImageFile = shadow_location;
 
-			try {
-				Assembly = Cecil.AssemblyFactory.GetAssembly (ImageFile);
-			} catch (Exception ex) {
+			MonoSymbolFileLoader.Job job = language.SymbolFileLoader.Load (ImageFile);
+			if (job.AssemblyError != null)
 				throw new SymbolTableException (
-					"Cannot load symbol file `{0}': {1}", ImageFile, ex);
-			}
+					"Cannot load symbol file `{0}': {1}", ImageFile, job.AssemblyError);
 
+			Assembly = job.Assembly;
 			ModuleDefinition = Assembly.MainModule;
 
 			Report.Debug (DebugFlags.JitSymtab, "SYMBOL TABLE READER: {0}", ImageFile);
 
-			string mdb_file = ImageFile + ".mdb";
-
-			try {
-				File = C.MonoSymbolFile.ReadSymbolFile (Assembly, mdb_file);
-				if (File == null)
-					Report.Error ("Cannot load symbol file `{0}'", mdb_file);
-				else if (ModuleDefinition.Mvid != File.Guid) {
-					Report.Error ("Symbol file `{0}' does not match assembly `{1}'",
-						      mdb_file, ImageFile);
-					File = null;
-				}
-			} catch (C.MonoSymbolFileException ex) {
-				Report.Error (ex.Message);
-			} catch (Exception ex) {
-				Report.Error ("Cannot load symbol file `{0}': {1}", mdb_file, ex);
-			}
+			symbol_job = job.SymbolJob;
 
 			symtab = new MonoSymbolTable (this);
 
@@ -284,6 +270,44 @@ namespace Mono.Debugger.Backend.Mono
 					      GetType (), ImageFile, Module);
 		}
 
+		// <summary>
+		//   The .mdb file, or null if we don't have one.  It's read in the
+		//   background; this waits until it's loaded.
+		// </summary>
+		internal C.MonoSymbolFile File {
+			get {
+				lock (this) {
+					if (!file_loaded) {
+						file = load_symbol_file ();
+						file_loaded = true;
+					}
+					return file;
+				}
+			}
+		}
+
+		C.MonoSymbolFile load_symbol_file ()
+		{
+			symbol_job.Wait ();
+
+			string mdb_file = symbol_job.Job.SymbolFile;
+			Exception error = symbol_job.FileError;
+
+			if (error is C.MonoSymbolFileException)
+				Report.Error (error.Message);
+			else if (error != null)
+				Report.Error ("Cannot load symbol file `{0}': {1}", mdb_file, error);
+			else if (symbol_job.File == null)
+				Report.Error ("Cannot load symbol file `{0}'", mdb_file);
+			else if (ModuleDefinition.Mvid != symbol_job.File.Guid)
+				Report.Error ("Symbol file `{0}' does not match assembly `{1}'",
+					      mdb_file, ImageFile);
+			else
+				return symbol_job.File;
+
+			return null;
+		}
+
 		protected ArrayList SymbolRanges {
 			get { return ranges; }
 		}
@@ -335,6 +359,7 @@ namespace Mono.Debugger.Backend.Mono
 			if (!range_hash.Contains (range.Hash)) {
 				range_hash.Add (range.Hash, range);
 				ranges.Add (range);
+				process.SymbolTableManager.AddSymbolRange (range);
 			}
 		}
 
@@ -345,6 +370,7 @@ namespace Mono.Debugger.Backend.Mono
 			if (!range_hash.Contains (range.Hash)) {
 				range_hash.Add (range.Hash, range);
 				ranges.Add (range);
+				process.SymbolTableManager.AddSymbolRange (range);
 			}
 			return range.GetMethod ();
 		}
@@ -846,8 +872,9 @@ namespace Mono.Debugger.Backend.Mono
 
 		protected override void DoDispose ()
 		{
-			if (File != null)
-				File.Dispose ();
+			symbol_job.Wait ();
+			if (symbol_job.File != null)
+				symbol_job.File.Dispose ();
 			base.DoDispose ();
 		}
 
@@ -0,0 +1,184 @@
+using System;
+using System.Collections.Generic;
+using C = Mono.CompilerServices.SymbolWriter;
+
+namespace Mono.Debugger.Backend.Mono
+{
+	// <summary>
+	//   Loads the Cecil assembly and the .mdb file for a MonoSymbolFile on the
+	//   process's SymbolLoadQueue.
+	//
+	//   Reading the MonoSymbolFile's runtime structures must happen on the
+	//   engine thread, but loading the assembly and the symbol file only touches
+	//   the disk.  When we attach to a running application, we queue all the
+	//   images up front and then create the MonoSymbolFiles in order.
+	//
+	//   This happens in two steps: the MonoSymbolFile needs its assembly right
+	//   away to create its Module, so its constructor waits for the Job which
+	//   loads the assembly.  Once that's done, the Job queues a SymbolJob which
+	//   reads and indexes the .mdb file; the MonoSymbolFile only waits for that
+	//   when somebody actually needs its debugging info, so attaching doesn't
+	//   wait for the symbol files.
+	// </summary>
+	internal class MonoSymbolFileLoader : IDisposable
+	{
+		Process process;
+		Dictionary<string,Job> jobs = new Dictionary<string,Job> ();
+		bool disposed;
+
+		public MonoSymbolFileLoader (Process process)
+		{
+			this.process = process;
+		}
+
+		SymbolLoadQueue LoadQueue {
+			get { return process.SymbolTableManager.LoadQueue; }
+		}
+
+		public void Queue (string image_file)
+		{
+			Job job;
+			lock (this) {
+				if (disposed || jobs.ContainsKey (image_file))
+					return;
+
+				job = new Job (this, image_file);
+				jobs.Add (image_file, job);
+			}
+
+			LoadQueue.Queue (job);
+		}
+
+		// <summary>
+		//   Returns the job for @image_file once its assembly is loaded.  Only
+		//   blocks if a worker is currently loading this very assembly.
+		// </summary>
+		public Job Load (string image_file)
+		{
+			Job job;
+			lock (this) {
+				if (jobs.TryGetValue (image_file, out job))
+					jobs.Remove (image_file);
+				else
+					job = new Job (this, image_file);
+			}
+
+			job.Wait ();
+			return job;
+		}
+
+		public class Job : SymbolLoadQueue.Job
+		{
+			public readonly MonoSymbolFileLoader Loader;
+			public readonly string ImageFile;
+
+			Cecil.AssemblyDefinition assembly;
+			Exception assembly_error;
+			SymbolJob symbol_job;
+
+			public Job (MonoSymbolFileLoader loader, string image_file)
+			{
+				this.Loader = loader;
+				this.ImageFile = image_file;
+			}
+
+			public Cecil.AssemblyDefinition Assembly {
+				get { return assembly; }
+			}
+
+			public Exception AssemblyError {
+				get { return assembly_error; }
+			}
+
+			// <summary>
+			//   The job which loads the symbol file, or null if we couldn't
+			//   load the assembly.
+			// </summary>
+			public SymbolJob SymbolJob {
+				get { return symbol_job; }
+			}
+
+			public string SymbolFile {
+				get { return ImageFile + ".mdb"; }
+			}
+
+			protected override void DoRun ()
+			{
+				try {
+					assembly = Cecil.AssemblyFactory.GetAssembly (ImageFile);
+				} catch (Exception ex) {
+					assembly_error = ex;
+					return;
+				}
+
+				symbol_job = new SymbolJob (this);
+				Loader.LoadQueue.Queue (symbol_job);
+			}
+
+			public override string ToString ()
+			{
+				return String.Format ("{0} ({1})", base.ToString (), ImageFile);
+			}
+		}
+
+		public class SymbolJob : SymbolLoadQueue.Job
+		{
+			public readonly Job Job;
+
+			C.MonoSymbolFile file;
+			Exception file_error;
+
+			public SymbolJob (Job job)
+			{
+				this.Job = job;
+			}
+
+			public C.MonoSymbolFile File {
+				get { return file; }
+			}
+
+			public Exception FileError {
+				get { return file_error; }
+			}
+
+			protected override void DoRun ()
+			{
+				try {
+					file = C.MonoSymbolFile.ReadSymbolFile (Job.Assembly, Job.SymbolFile);
+					if (file == null)
+						return;
+
+					//
+					// Read the source file and method tables now; that's what
+					// the MonoSymbolFile needs first.
+					//
+					C.SourceFileEntry[] sources = file.Sources;
+					C.MethodEntry[] methods = file.Methods;
+				} catch (Exception ex) {
+					file_error = ex;
+				}
+			}
+
+			public override string ToString ()
+			{
+				return String.Format ("{0} ({1})", base.ToString (), Job.SymbolFile);
+			}
+		}
+
+		//
+		// IDisposable
+		//
+
+		public void Dispose ()
+		{
+			lock (this) {
+				if (disposed)
+					return;
+
+				// Anything which is still queued is loaded on demand.
+				disposed = true;
+				jobs.Clear ();
+			}
+		}
+	}
+}
@@ -128,6 +128,26 @@ namespace Mono.Debugger.Backend.Mono
 			IntPtr runtime, long executable_code_buffer,
 			int executable_code_buffer_size);
 
+		[DllImport("monodebuggerserver")]
+		static extern void mono_debugger_server_get_runtime_slot_usage (
+			IntPtr runtime, out int breakpoint_slots_used, out int breakpoint_slots_total,
+			out int code_slots_used, out int code_slots_total);
+
+		internal void GetRuntimeSlotUsage (out int breakpoint_slots_used,
+						   out int breakpoint_slots_total,
+						   out int code_slots_used, out int code_slots_total)
+		{
+			if (mono_runtime_info == IntPtr.Zero) {
+				breakpoint_slots_used = breakpoint_slots_total = 0;
+				code_slots_used = code_slots_total = 0;
+				return;
+			}
+
+			mono_debugger_server_get_runtime_slot_usage (
+				mono_runtime_info, out breakpoint_slots_used, out breakpoint_slots_total,
+				out code_slots_used, out code_slots_total);
+		}
+
 		protected void initialize_notifications (Inferior inferior)
 		{
 			TargetAddress executable_code_buffer = inferior.ReadAddress (
@@ -2,6 +2,7 @@ using System;
 using System.IO;
 using System.Text;
 using System.Collections;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
 using Mono.Debugger;
@@ -25,8 +26,13 @@ namespace Mono.Debugger.Backend
 		Hashtable symbols;
 		Hashtable local_symbols;
 		ArrayList simple_symbols;
+		bool simple_symbols_sorted;
 		BfdSymbolTable simple_symtab;
+		string build_id;
+		bool build_id_read;
+		Dictionary<IntPtr,MappedSection> mapped_sections;
 		DwarfReader dwarf;
+		DwarfJob dwarf_job;
 		DwarfFrameReader frame_reader, eh_frame_reader;
 		bool dwarf_loaded;
 		bool frames_loaded;
@@ -73,10 +79,10 @@ namespace Mono.Debugger.Backend
 
 			object get_section_contents (object user_data)
 			{
-				byte[] data = bfd.GetSectionContents (section);
-				if (data == null)
+				TargetBlob blob = bfd.GetSectionBlob (section);
+				if (blob == null)
 					throw new SymbolTableException ("Can't get bfd section {0}", name);
-				return new TargetReader (data, bfd.info);
+				return new TargetReader (blob);
 			}
 
 			public TargetReader GetReader (TargetAddress address)
@@ -141,6 +147,12 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		extern static bool bfd_glue_get_section_contents (IntPtr bfd, IntPtr section, IntPtr data, int size);
 
+		[DllImport("monodebuggerserver")]
+		extern static IntPtr bfd_glue_map_section_contents (IntPtr bfd, IntPtr section, out int offset, out int map_size);
+
+		[DllImport("monodebuggerserver")]
+		extern static void bfd_glue_unmap_section_contents (IntPtr map, int map_size);
+
 		[DllImport("monodebuggerserver")]
 		extern static IntPtr bfd_glue_get_first_section (IntPtr bfd);
 
@@ -172,6 +184,8 @@ namespace Mono.Debugger.Backend
 		extern static string bfd_glue_get_symbol (IntPtr bfd, IntPtr symtab, int index,
 							  out int is_function, out long address);
 
+		static readonly object bfd_lock = new object ();
+
 		static Bfd ()
 		{
 			bfd_init ();
@@ -188,42 +202,50 @@ namespace Mono.Debugger.Backend
 
 			this.symfile = new BfdSymbolFile (this);
 
-			bfd = bfd_glue_openr (filename, null);
-			if (bfd == IntPtr.Zero)
-				throw new SymbolTableException ("Can't read symbol file: {0}", filename);
-
-			if (bfd_glue_check_format_archive (bfd))
-			{
-				IntPtr archive = bfd;
-				bfd = IntPtr.Zero;
-				
-				while (true) {
-					bfd = bfd_glue_openr_next_archived_file (archive, bfd);
-					if(bfd == IntPtr.Zero)
-						throw new SymbolTableException ("Can't read symbol file: {0}", filename);
-					
-					if (bfd_glue_check_format_object(bfd))
-					{
-						/*
-						 * At this point, just check for mach-o-le (OS X X86 binary).
-						 * When we want to support other architctures in fat binarys,
-						 * we need to somehow get the correct target string for the
-						 * process, and chech against that.
-						 */
-						if (bfd_glue_get_target_name(bfd) == "mach-o-le")
-							break;
+			//
+			// libbfd isn't thread-safe and the DWARF readers use it from the
+			// SymbolLoadQueue workers, so all the calls which read the file
+			// must hold the bfd_lock.
+			//
+			lock (bfd_lock) {
+				bfd = bfd_glue_openr (filename, null);
+				if (bfd == IntPtr.Zero)
+					throw new SymbolTableException ("Can't read symbol file: {0}", filename);
+
+				if (bfd_glue_check_format_archive (bfd))
+				{
+					IntPtr archive = bfd;
+					bfd = IntPtr.Zero;
+
+					while (true) {
+						bfd = bfd_glue_openr_next_archived_file (archive, bfd);
+						if(bfd == IntPtr.Zero)
+							throw new SymbolTableException ("Can't read symbol file: {0}", filename);
+
+						if (bfd_glue_check_format_object(bfd))
+						{
+							/*
+							 * At this point, just check for mach-o-le (OS X X86 binary).
+							 * When we want to support other architctures in fat binarys,
+							 * we need to somehow get the correct target string for the
+							 * process, and chech against that.
+							 */
+							if (bfd_glue_get_target_name(bfd) == "mach-o-le")
+								break;
+						}
 					}
 				}
+
+				if (bfd_glue_check_format_object (bfd))
+					is_coredump = false;
+				else if (bfd_glue_check_format_core (bfd))
+					is_coredump = true;
+				else
+					throw new SymbolTableException ("Not an object file: {0}", filename);
+
+				target = bfd_glue_get_target_name (bfd);
 			}
-			
-			if (bfd_glue_check_format_object (bfd))
-				is_coredump = false;
-			else if (bfd_glue_check_format_core (bfd))
-				is_coredump = true;
-			else
-				throw new SymbolTableException ("Not an object file: {0}", filename);
 
-			target = bfd_glue_get_target_name (bfd);
 			if ((target == "elf32-i386") || (target == "elf64-x86-64")) {
 				if (!is_coredump) {
 					Section text = GetSectionByName (".text", false);
@@ -316,15 +338,161 @@ namespace Mono.Debugger.Backend
 			return core;
 		}
 
-		void read_bfd_symbols ()
+		// <summary>
+		//   The hex-encoded ELF build-id or null if the file doesn't have one.
+		// </summary>
+		internal string BuildID {
+			get {
+				lock (this) {
+					if (!build_id_read) {
+						build_id = read_build_id ();
+						build_id_read = true;
+					}
+					return build_id;
+				}
+			}
+		}
+
+		string read_build_id ()
 		{
-			IntPtr symtab;
-			int num_symbols = bfd_glue_get_symbols (bfd, out symtab);
+			if (!HasSection (".note.gnu.build-id"))
+				return null;
+
+			byte[] note;
+			try {
+				note = GetSectionContents (".note.gnu.build-id");
+			} catch {
+				return null;
+			}
+
+			//
+			// Elf_Nhdr: namesz, descsz, type, then the 4-byte aligned name
+			// ("GNU") and the build-id itself.
+			//
+			if (note.Length < 12)
+				return null;
+
+			int namesz = BitConverter.ToInt32 (note, 0);
+			int descsz = BitConverter.ToInt32 (note, 4);
+			int type = BitConverter.ToInt32 (note, 8);
+			int desc = 12 + ((namesz + 3) & ~3);
+
+			if ((type != 3) || (descsz <= 0) || (desc + descsz > note.Length))
+				return null;
 
+			StringBuilder sb = new StringBuilder ();
+			for (int i = 0; i < descsz; i++)
+				sb.Append (note [desc + i].ToString ("x2"));
+			return sb.ToString ();
+		}
+
+		enum CachedSymbolKind : byte {
+			Global,
+			Local,
+			Dynamic
+		}
+
+		void add_symbol (string name, long address, CachedSymbolKind kind)
+		{
+			TargetAddress relocated = new TargetAddress (
+				info.AddressDomain, base_address.Address + address);
+
+			if ((kind == CachedSymbolKind.Global) && !symbols.Contains (name))
+				symbols.Add (name, relocated);
+			else if ((kind != CachedSymbolKind.Dynamic) && !local_symbols.Contains (name))
+				local_symbols.Add (name, relocated);
+
+			simple_symbols.Add (new Symbol (name, relocated, 0));
+		}
+
+		//
+		// The cached symbol table contains all the symbols in the order in which
+		// bfd returned them - so we get the same `symbols' and `local_symbols' -
+		// followed by the order in which they appear in the sorted simple
+		// symbol table.
+		//
+
+		bool load_cached_symbols ()
+		{
+			BinaryReader reader = SymbolIndexCache.Open (BuildID, "symtab", filename);
+			if (reader == null)
+				return false;
+
+			try {
+				int count = reader.ReadInt32 ();
+				string[] names = new string [count];
+				long[] addresses = new long [count];
+
+				for (int i = 0; i < count; i++) {
+					names [i] = reader.ReadString ();
+					addresses [i] = reader.ReadInt64 ();
+					add_symbol (names [i], addresses [i],
+						    (CachedSymbolKind) reader.ReadByte ());
+				}
+
+				simple_symbols = new ArrayList (count);
+				for (int i = 0; i < count; i++) {
+					int index = reader.ReadInt32 ();
+					simple_symbols.Add (new Symbol (
+						names [index], new TargetAddress (
+							info.AddressDomain,
+							base_address.Address + addresses [index]), 0));
+				}
+
+				simple_symbols_sorted = true;
+				return true;
+			} catch (Exception ex) {
+				Report.Debug (DebugFlags.SymbolTable,
+					      "Corrupt symbol index for {0}: {1}", filename, ex.Message);
+				SymbolIndexCache.Discard (BuildID, "symtab");
+				return false;
+			} finally {
+				reader.Close ();
+			}
+		}
+
+		void save_cached_symbols (ArrayList names, ArrayList addresses, ArrayList kinds)
+		{
+			long[] keys = new long [names.Count];
+			int[] order = new int [names.Count];
+			for (int i = 0; i < keys.Length; i++) {
+				keys [i] = (long) addresses [i];
+				order [i] = i;
+			}
+			Array.Sort (keys, order);
+
+			SymbolIndexCache.Save (BuildID, "symtab", filename, delegate (BinaryWriter writer) {
+				writer.Write (names.Count);
+				for (int i = 0; i < names.Count; i++) {
+					writer.Write ((string) names [i]);
+					writer.Write ((long) addresses [i]);
+					writer.Write ((byte) (CachedSymbolKind) kinds [i]);
+				}
+				for (int i = 0; i < order.Length; i++)
+					writer.Write (order [i]);
+			});
+		}
+
+		void read_bfd_symbols ()
+		{
 			symbols = new Hashtable ();
 			local_symbols = new Hashtable ();
 			simple_symbols = new ArrayList ();
 
+			if (load_cached_symbols ()) {
+				simple_symtab = new BfdSymbolTable (this);
+				return;
+			}
+
+			ArrayList cached_names = new ArrayList ();
+			ArrayList cached_addresses = new ArrayList ();
+			ArrayList cached_kinds = new ArrayList ();
+
+			IntPtr symtab;
+			int num_symbols;
+			lock (bfd_lock)
+				num_symbols = bfd_glue_get_symbols (bfd, out symtab);
+
 			bool is_mach = (bfd_glue_get_target_name (bfd) == "mach-o-le");
 
 			for (int i = 0; i < num_symbols; i++) {
@@ -341,21 +509,23 @@ namespace Mono.Debugger.Backend
 						name = name.Substring(1);
 				}
 
-				TargetAddress relocated = new TargetAddress (
-					info.AddressDomain, base_address.Address + address);
-				if (is_function != 0 && !symbols.Contains (name))
-					symbols.Add (name, relocated);
-				else if (name.StartsWith ("MONO_DEBUGGER__") && !symbols.Contains (name))
-					symbols.Add (name, relocated);
-				else if (!local_symbols.Contains (name))
-					local_symbols.Add (name, relocated);
+				CachedSymbolKind kind;
+				if ((is_function != 0) || name.StartsWith ("MONO_DEBUGGER__"))
+					kind = CachedSymbolKind.Global;
+				else
+					kind = CachedSymbolKind.Local;
+
+				add_symbol (name, address, kind);
 
-				simple_symbols.Add (new Symbol (name, relocated, 0));
+				cached_names.Add (name);
+				cached_addresses.Add (address);
+				cached_kinds.Add (kind);
 			}
 
 			g_free (symtab);
 
-			num_symbols = bfd_glue_get_dynamic_symbols (bfd, out symtab);
+			lock (bfd_lock)
+				num_symbols = bfd_glue_get_dynamic_symbols (bfd, out symtab);
 
 			for (int i = 0; i < num_symbols; i++) {
 				string name;
@@ -366,19 +536,26 @@ namespace Mono.Debugger.Backend
 				if (name == null)
 					continue;
 
-				TargetAddress relocated = new TargetAddress (
-					info.AddressDomain,
-					base_address.Address + address);
-				simple_symbols.Add (new Symbol (name, relocated, 0));
+				add_symbol (name, address, CachedSymbolKind.Dynamic);
+
+				cached_names.Add (name);
+				cached_addresses.Add (address);
+				cached_kinds.Add (CachedSymbolKind.Dynamic);
 			}
 
 			g_free (symtab);
 
+			save_cached_symbols (cached_names, cached_addresses, cached_kinds);
+
 			simple_symtab = new BfdSymbolTable (this);
 		}
 
 		protected ArrayList GetSimpleSymbols ()
 		{
+			if (!simple_symbols_sorted) {
+				simple_symbols.Sort ();
+				simple_symbols_sorted = true;
+			}
 			return simple_symbols;
 		}
 
@@ -472,17 +649,38 @@ namespace Mono.Debugger.Backend
 		}
 
 		internal DwarfReader DwarfReader {
-			get { return dwarf; }
+			get { return get_dwarf (); }
 		}
 
+		// <summary>
+		//   Waits until the DwarfReader has been created in the background.
+		// </summary>
+		DwarfReader get_dwarf ()
+		{
+			DwarfJob job = dwarf_job;
+			if (job != null)
+				job.Wait ();
+			return dwarf;
+		}
+
+		//
+		// The symbols are "loaded" as soon as we started reading them; the
+		// accessors below wait until they're actually there.
+		//
+
 		protected bool SymbolsLoaded {
-			get { return (dwarf != null); }
+			get { return (dwarf_job != null) ? has_debugging_info : (dwarf != null); }
+		}
+
+		protected bool SymbolsPending {
+			get { return (dwarf_job != null) && !dwarf_job.IsCompleted; }
 		}
 
 		protected SourceFile[] Sources {
 			get {
-				if (dwarf != null)
-					return dwarf.Sources;
+				DwarfReader reader = get_dwarf ();
+				if (reader != null)
+					return reader.Sources;
 
 				throw new InvalidOperationException ();
 			}
@@ -490,24 +688,27 @@ namespace Mono.Debugger.Backend
 
 		protected MethodSource[] GetMethods (SourceFile file)
 		{
-			if (dwarf != null)
-				return dwarf.GetMethods (file);
+			DwarfReader reader = get_dwarf ();
+			if (reader != null)
+				return reader.GetMethods (file);
 
 			throw new InvalidOperationException ();
 		}
 
 		protected MethodSource FindMethod (string name)
 		{
-			if (dwarf != null)
-				return dwarf.FindMethod (name);
+			DwarfReader reader = get_dwarf ();
+			if (reader != null)
+				return reader.FindMethod (name);
 
 			return null;
 		}
 
 		protected ISymbolTable SymbolTable {
 			get {
-				if (dwarf != null)
-					return dwarf.SymbolTable;
+				DwarfReader reader = get_dwarf ();
+				if (reader != null)
+					return reader.SymbolTable;
 				else
 					throw new InvalidOperationException ();
 			}
@@ -530,18 +731,25 @@ namespace Mono.Debugger.Backend
 			long vma_base = base_address.IsNull ? 0 : base_address.Address;
 			Section section = GetSectionByName (".debug_frame", false);
 			if (section != null) {
-				byte[] contents = GetSectionContents (section.section);
-				TargetBlob blob = new TargetBlob (contents, info);
+				TargetBlob blob = GetSectionBlob (section.section);
 				frame_reader = new DwarfFrameReader (
 					this, blob, vma_base + section.vma, false);
 			}
 
 			section = GetSectionByName (".eh_frame", false);
 			if (section != null) {
-				byte[] contents = GetSectionContents (section.section);
-				TargetBlob blob = new TargetBlob (contents, info);
+				TargetBlob blob = GetSectionBlob (section.section);
+
+				TargetBlob hdr_blob = null;
+				long hdr_vma = 0;
+				Section hdr = GetSectionByName (".eh_frame_hdr", false);
+				if (hdr != null) {
+					hdr_blob = GetSectionBlob (hdr.section);
+					hdr_vma = vma_base + hdr.vma;
+				}
+
 				eh_frame_reader = new DwarfFrameReader (
-					this, blob, vma_base + section.vma, true);
+					this, blob, vma_base + section.vma, true, hdr_blob, hdr_vma);
 			}
 		}
 
@@ -560,24 +768,46 @@ namespace Mono.Debugger.Backend
 			frames_loaded = true;
 		}
 
+		// <summary>
+		//   Reads the DWARF debugging info on a SymbolLoadQueue worker.
+		// </summary>
+		class DwarfJob : SymbolLoadQueue.Job
+		{
+			public readonly Bfd Bfd;
+
+			public DwarfJob (Bfd bfd)
+			{
+				this.Bfd = bfd;
+			}
+
+			protected override void DoRun ()
+			{
+				Bfd.read_dwarf ();
+			}
+		}
+
 		void load_dwarf ()
 		{
 			if (dwarf_loaded || !has_debugging_info)
 				return;
 
+			dwarf_loaded = true;
+
+			dwarf_job = new DwarfJob (this);
+			os.Process.SymbolTableManager.LoadQueue.Queue (dwarf_job);
+		}
+
+		void read_dwarf ()
+		{
 			try {
 				dwarf = new DwarfReader (this, module);
 			} catch (Exception ex) {
 				Console.WriteLine ("Cannot read DWARF debugging info from " +
 						   "symbol file `{0}': {1}", FileName, ex);
 				has_debugging_info = false;
-				return;
 			}
 
-			dwarf_loaded = true;
-
-			if (dwarf != null)
-				has_debugging_info = true;
+			os.Process.SymbolTableManager.SymbolFileChanged (symfile);
 		}
 
 		void unload_dwarf ()
@@ -585,7 +815,10 @@ namespace Mono.Debugger.Backend
 			if (!dwarf_loaded || !has_debugging_info)
 				return;
 
+			get_dwarf ();
+
 			dwarf_loaded = false;
+			dwarf_job = null;
 			dwarf = null;
 		}
 
@@ -598,6 +831,8 @@ namespace Mono.Debugger.Backend
 			} else {
 				unload_dwarf ();
 			}
+
+			os.Process.SymbolTableManager.SymbolFileChanged (symfile);
 		}
 
 		public override TargetAddress LookupSymbol (string name)
@@ -739,6 +974,15 @@ namespace Mono.Debugger.Backend
 		}
 
 		public byte[] GetSectionContents (string name)
+		{
+			return GetSectionBlob (name).Contents;
+		}
+
+		// <summary>
+		//   Returns the section's contents.  If we could mmap() the section,
+		//   the blob reads directly from the mapping.
+		// </summary>
+		public TargetBlob GetSectionBlob (string name)
 		{
 			IntPtr section;
 
@@ -746,36 +990,92 @@ namespace Mono.Debugger.Backend
 			if (section == IntPtr.Zero)
 				throw new SymbolTableException ("Can't find bfd section {0}", name);
 
-			byte[] contents = GetSectionContents (section);
-			if (contents == null)
+			TargetBlob blob = GetSectionBlob (section);
+			if (blob == null)
 				throw new SymbolTableException ("Can't read bfd section {0}", name);
-			return contents;
+			return blob;
 		}
 
 		public TargetReader GetSectionReader (string name)
 		{
-			byte[] contents = GetSectionContents (name);
-			if (contents == null)
-				throw new SymbolTableException ("Can't read bfd section {0}", name);
-			return new TargetReader (contents, info);
+			return new TargetReader (GetSectionBlob (name));
 		}
 
-		byte[] GetSectionContents (IntPtr section)
+		// <summary>
+		//   A section which is mmap()ed directly from the file.  The mapping stays
+		//   around until the Bfd is disposed; the readers read directly from it,
+		//   so the section is never copied and only the pages we actually touch
+		//   are read from the disk.
+		// </summary>
+		class MappedSection
 		{
+			public readonly IntPtr Map;
+			public readonly int Offset;
+			public readonly int MapSize;
+
+			public MappedSection (IntPtr map, int offset, int map_size)
+			{
+				this.Map = map;
+				this.Offset = offset;
+				this.MapSize = map_size;
+			}
+
+			public TargetBlob GetBlob (TargetMemoryInfo info)
+			{
+				return new TargetBlob (
+					(IntPtr) (Map.ToInt64 () + Offset), MapSize - Offset, info);
+			}
+
+			public void Unmap ()
+			{
+				bfd_glue_unmap_section_contents (Map, MapSize);
+			}
+		}
+
+		MappedSection map_section (IntPtr section)
+		{
+			lock (this) {
+				if (mapped_sections == null)
+					mapped_sections = new Dictionary<IntPtr,MappedSection> ();
+
+				MappedSection mapped;
+				if (mapped_sections.TryGetValue (section, out mapped))
+					return mapped;
+
+				int offset, map_size;
+				IntPtr map = bfd_glue_map_section_contents (
+					bfd, section, out offset, out map_size);
+				if (map != IntPtr.Zero)
+					mapped = new MappedSection (map, offset, map_size);
+
+				// Also remember that we can't map it.
+				mapped_sections.Add (section, mapped);
+				return mapped;
+			}
+		}
+
+		TargetBlob GetSectionBlob (IntPtr section)
+		{
+			MappedSection mapped = map_section (section);
+			if (mapped != null)
+				return mapped.GetBlob (info);
+
 			int size = bfd_glue_get_section_size (section);
 			IntPtr data = IntPtr.Zero;
 			try {
 				data = Marshal.AllocHGlobal (size);
-				if (!bfd_glue_get_section_contents (bfd, section, data, size)) {
-					string error = bfd_glue_get_errormsg ();
-					string name = bfd_glue_get_section_name (section);
+				lock (bfd_lock) {
+					if (!bfd_glue_get_section_contents (bfd, section, data, size)) {
+						string error = bfd_glue_get_errormsg ();
+						string name = bfd_glue_get_section_name (section);
 
-					throw new SymbolTableException (
-						"Can't read bfd section {0}: {1}", name, error);
+						throw new SymbolTableException (
+							"Can't read bfd section {0}: {1}", name, error);
+					}
 				}
 				byte[] retval = new byte [size];
 				Marshal.Copy (data, retval, 0, size);
-				return retval;
+				return new TargetBlob (retval, info);
 			} finally {
 				Marshal.FreeHGlobal (data);
 			}
@@ -939,8 +1239,9 @@ namespace Mono.Debugger.Backend
 
 		public void ReadTypes ()
 		{
-			if (dwarf != null)
-				dwarf.ReadTypes ();
+			DwarfReader reader = get_dwarf ();
+			if (reader != null)
+				reader.ReadTypes ();
 		}
 
 		protected class BfdSymbolFile : SymbolFile
@@ -980,6 +1281,23 @@ namespace Mono.Debugger.Backend
 				get { return Bfd.SymbolsLoaded; }
 			}
 
+			internal override bool SymbolsPending {
+				get { return Bfd.SymbolsPending; }
+			}
+
+			internal override void WaitForSymbols ()
+			{
+				Bfd.get_dwarf ();
+			}
+
+			internal override bool CoversAddress (TargetAddress address)
+			{
+				if (!Bfd.IsContinuous)
+					return true;
+
+				return (address >= Bfd.StartAddress) && (address < Bfd.EndAddress);
+			}
+
 			public override SourceFile[] Sources {
 				get { return Bfd.Sources; }
 			}
@@ -1020,61 +1338,100 @@ namespace Mono.Debugger.Backend
 
 		private class BfdSymbolTable
 		{
+			struct SymbolEntry
+			{
+				public readonly long Address;
+				public readonly string Name;
+
+				public SymbolEntry (long address, string name)
+				{
+					this.Address = address;
+					this.Name = name;
+				}
+			}
+
 			Bfd bfd;
-			Symbol[] list;
+			SymbolEntry[] list;
 
 			public BfdSymbolTable (Bfd bfd)
 			{
 				this.bfd = bfd;
 			}
 
-			public Symbol SimpleLookup (TargetAddress address, bool exact_match)
+			void read_symbols ()
 			{
-				if (bfd.IsContinuous &&
-				    ((address < bfd.StartAddress) || (address >= bfd.EndAddress)))
-					return null;
+				ArrayList the_list = bfd.GetSimpleSymbols ();
 
-				if (list == null) {
-					ArrayList the_list = bfd.GetSimpleSymbols ();
-					the_list.Sort ();
+				list = new SymbolEntry [the_list.Count];
+				for (int i = 0; i < list.Length; i++) {
+					Symbol symbol = (Symbol) the_list [i];
+					list [i] = new SymbolEntry (symbol.Address.Address, symbol.Name);
+				}
+			}
 
-					list = new Symbol [the_list.Count];
-					the_list.CopyTo (list);
+			// <summary>
+			//   Returns the index of the first entry whose address is greater
+			//   than @address.
+			// </summary>
+			int upper_bound (long address)
+			{
+				int lo = 0, hi = list.Length;
+
+				while (lo < hi) {
+					int mid = lo + (hi - lo) / 2;
+					if (list [mid].Address <= address)
+						lo = mid + 1;
+					else
+						hi = mid;
 				}
 
-				for (int i = list.Length - 1; i >= 0; i--) {
-					Symbol entry = list [i];
+				return lo;
+			}
 
-					if (address < entry.Address)
-						continue;
+			public Symbol SimpleLookup (TargetAddress address, bool exact_match)
+			{
+				if (bfd.IsContinuous &&
+				    ((address < bfd.StartAddress) || (address >= bfd.EndAddress)))
+					return null;
 
-					long offset = address - entry.Address;
-					if (offset == 0) {
-						while (i > 0) {
-							Symbol n_entry = list [--i];
+				if (list == null)
+					read_symbols ();
 
-							if (n_entry.Address == entry.Address) 
-								entry = n_entry;
-							else
-								break;
-						}
+				int i = upper_bound (address.Address) - 1;
+				if (i < 0)
+					return null;
 
-						return new Symbol (entry.Name, address, 0);
-					} else if (exact_match)
-						return null;
-					else
-						return new Symbol (
-							entry.Name, address - offset,
-							(int) offset);
-				}
+				SymbolEntry entry = list [i];
+				long offset = address.Address - entry.Address;
+				if (offset == 0) {
+					while ((i > 0) && (list [i - 1].Address == entry.Address))
+						entry = list [--i];
 
-				return null;
+					return new Symbol (entry.Name, address, 0);
+				} else if (exact_match)
+					return null;
+				else
+					return new Symbol (
+						entry.Name, address - offset, (int) offset);
 			}
 		}
 
 		protected override void DoDispose ()
 		{
-			bfd_close (bfd);
+			// Don't pull the file out from under a DWARF reader.
+			if (dwarf_job != null)
+				dwarf_job.Wait ();
+
+			if (mapped_sections != null) {
+				foreach (MappedSection mapped in mapped_sections.Values) {
+					if (mapped != null)
+						mapped.Unmap ();
+				}
+				mapped_sections = null;
+			}
+
+			lock (bfd_lock)
+				bfd_close (bfd);
 			bfd = IntPtr.Zero;
 			base.DoDispose ();
 		}
@@ -24,6 +24,17 @@ namespace Mono.Debugger.Backend
 		[DllImport("monodebuggerserver")]
 		extern static void bfd_glue_free_disassembler (IntPtr handle);
 
+		[DllImport("monodebuggerserver")]
+		extern static int bfd_glue_disassemble_range (IntPtr handle, long start, byte[] code, int size, out IntPtr insns, out IntPtr text);
+
+		[DllImport("libglib-2.0-0.dll")]
+		extern static void g_free (IntPtr data);
+
+		// <summary>
+		//   Size of a `BfdGlueDisassembledInsn' in 32-bit words.
+		// </summary>
+		const int InsnInfoSize = 8;
+
 		ReadMemoryHandler read_handler;
 		OutputHandler output_handler;
 		PrintAddressHandler print_handler;
@@ -75,6 +86,11 @@ namespace Mono.Debugger.Backend
 		}
 
 		void print_address_func (long address)
+		{
+			output_func (format_address (address));
+		}
+
+		string format_address (long address)
 		{
 			TargetAddress maddress = new TargetAddress (
 				memory.AddressDomain, address);
@@ -84,10 +100,8 @@ namespace Mono.Debugger.Backend
 					MethodSource method = current_method.GetTrampoline (
 						memory, maddress);
 
-					if (method != null) {
-						output_func (method.Name);
-						return;
-					}
+					if (method != null)
+						return method.Name;
 				} catch (TargetException) {
 				}
 			}
@@ -97,9 +111,9 @@ namespace Mono.Debugger.Backend
 				name = process.SymbolTableManager.SimpleLookup (maddress, false);
 
 			if (name == null)
-				output_func (address);
+				return String.Format ("0x{0:x}", address);
 			else
-				output_func (String.Format ("0x{0:x}:{1}", address, name.ToString ()));
+				return String.Format ("0x{0:x}:{1}", address, name.ToString ());
 		}
 
 		public override int GetInstructionSize (TargetMemoryAccess memory, TargetAddress address)
@@ -118,7 +132,88 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
+		// <summary>
+		//   Read the whole method and let the native side disassemble it in one
+		//   go; we only need to look up the labels and the addresses it printed.
+		// </summary>
 		public override AssemblerMethod DisassembleMethod (TargetMemoryAccess memory, Method method)
+		{
+			lock (this) {
+				TargetAddress start = new TargetAddress (
+					memory.AddressDomain, method.StartAddress.Address);
+				int size = (int) (method.EndAddress - method.StartAddress);
+
+				byte[] code;
+				try {
+					code = memory.ReadBuffer (start, size);
+				} catch (TargetException) {
+					return disassemble_method_slow (memory, method);
+				}
+
+				IntPtr insns_ptr = IntPtr.Zero, text_ptr = IntPtr.Zero;
+				int[] insns;
+				string text;
+				try {
+					int count = bfd_glue_disassemble_range (
+						handle, start.Address, code, size, out insns_ptr, out text_ptr);
+
+					insns = new int [count * InsnInfoSize];
+					Marshal.Copy (insns_ptr, insns, 0, insns.Length);
+					text = Marshal.PtrToStringAnsi (text_ptr);
+				} finally {
+					g_free (insns_ptr);
+					g_free (text_ptr);
+				}
+
+				AssemblerLine[] lines = new AssemblerLine [insns.Length / InsnInfoSize];
+				try {
+					this.memory = memory;
+					current_method = method;
+
+					for (int i = 0; i < lines.Length; i++) {
+						int pos = i * InsnInfoSize;
+						long target = (uint) insns [pos] | ((long) insns [pos + 1] << 32);
+						int offset = insns [pos + 2];
+						int insn_size = insns [pos + 3];
+						int text_offset = insns [pos + 4];
+						int text_length = insns [pos + 5];
+						int target_offset = insns [pos + 6];
+						int target_length = insns [pos + 7];
+
+						string insn;
+						if (target_length > 0) {
+							int before = target_offset - text_offset;
+							insn = text.Substring (text_offset, before) +
+								format_address (target) +
+								text.Substring (target_offset + target_length,
+										text_length - before - target_length);
+						} else {
+							insn = text.Substring (text_offset, text_length);
+						}
+
+						TargetAddress address = start + offset;
+
+						Symbol label = null;
+						if (process != null)
+							label = process.SymbolTableManager.SimpleLookup (address, true);
+
+						string label_name = null;
+						if (label != null)
+							label_name = label.ToString ();
+
+						lines [i] = new AssemblerLine (
+							label_name, address, (byte) insn_size, insn);
+					}
+				} finally {
+					this.memory = null;
+					current_method = null;
+				}
+
+				return new AssemblerMethod (method, lines);
+			}
+		}
+
+		AssemblerMethod disassemble_method_slow (TargetMemoryAccess memory, Method method)
 		{
 			lock (this) {
 				ArrayList list = new ArrayList ();
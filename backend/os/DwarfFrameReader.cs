@@ -1,5 +1,6 @@
 using System;
 using System.Collections;
+using System.Collections.Generic;
 
 namespace Mono.Debugger.Backend
 {
@@ -9,87 +10,249 @@ namespace Mono.Debugger.Backend
 		protected readonly TargetBlob blob;
 		protected readonly bool is_ehframe;
 		protected readonly long vma;
-		protected CIE cie_list;
+		protected readonly TargetBlob hdr_blob;
+		protected readonly long hdr_vma;
+		protected Dictionary<long,CIE> cie_hash = new Dictionary<long,CIE> ();
+
+		// <summary>
+		//   Start address and section offset of each FDE, sorted by address.
+		//   This is built lazily from the `.eh_frame_hdr' search table if we
+		//   have one or by walking the whole section otherwise.
+		// </summary>
+		FDEIndexEntry[] fde_index;
+
+		// <summary>
+		//   Parsed unwind rules for the addresses we already unwound from.
+		// </summary>
+		Dictionary<long,Entry> rule_cache = new Dictionary<long,Entry> ();
+		public const int MaxCachedRules = 4096;
+
+		protected struct FDEIndexEntry
+		{
+			public readonly long Start;
+			public readonly long Offset;
+
+			public FDEIndexEntry (long start, long offset)
+			{
+				this.Start = start;
+				this.Offset = offset;
+			}
+		}
 
 		public DwarfFrameReader (Bfd bfd, TargetBlob blob, long vma,
 					 bool is_ehframe)
+			: this (bfd, blob, vma, is_ehframe, null, 0)
+		{ }
+
+		public DwarfFrameReader (Bfd bfd, TargetBlob blob, long vma,
+					 bool is_ehframe, TargetBlob hdr_blob, long hdr_vma)
 		{
 			this.bfd = bfd;
 			this.blob = blob;
 			this.vma = vma;
 			this.is_ehframe = is_ehframe;
+			this.hdr_blob = hdr_blob;
+			this.hdr_vma = hdr_vma;
 		}
 
 		protected CIE find_cie (long offset)
 		{
-			for (CIE cie = cie_list; cie != null; cie = cie.Next) {
-				if (cie.Offset == offset)
-					return cie;
+			CIE cie;
+			if (cie_hash.TryGetValue (offset, out cie))
+				return cie;
+
+			cie = new CIE (this, offset);
+			cie_hash.Add (offset, cie);
+			return cie;
+		}
+
+		// <summary>
+		//   Read the header of the FDE at the reader's current position.
+		//   Returns false if this is a CIE or the section terminator.
+		// </summary>
+		bool read_fde_header (DwarfBinaryReader reader, TargetMemoryAccess target,
+				      out CIE cie, out long initial, out long range,
+				      out long end_pos)
+		{
+			cie = null;
+			initial = range = 0;
+
+			long length = reader.ReadInitialLength ();
+			end_pos = reader.Position + length;
+			if (length == 0)
+				return false;
+
+			long cie_pointer = reader.ReadOffset ();
+			bool is_cie;
+			if (is_ehframe)
+				is_cie = cie_pointer == 0;
+			else
+				is_cie = cie_pointer == -1;
+
+			if (is_cie)
+				return false;
+
+			if (is_ehframe)
+				cie_pointer = reader.Position - cie_pointer -
+					target.TargetMemoryInfo.TargetAddressSize;
+
+			cie = find_cie (cie_pointer);
+
+			if (is_ehframe) {
+				initial = ReadEncodedValue (reader, cie.Encoding);
+				range = ReadEncodedValue (reader, cie.Encoding & 0x0f);
+			} else {
+				initial = reader.ReadAddress ();
+				range = reader.ReadAddress ();
 			}
 
-			CIE new_cie = new CIE (this, offset, cie_list);
-			cie_list = new_cie;
-			return cie_list;
+			return true;
 		}
 
-		public StackFrame UnwindStack (StackFrame frame, TargetMemoryAccess target,
-					       Architecture arch)
+		FDEIndexEntry[] read_eh_frame_hdr ()
 		{
-			if (frame.TargetAddress.IsNull)
+			TargetBinaryReader reader = hdr_blob.GetReader ();
+
+			int version = reader.ReadByte ();
+			byte eh_frame_ptr_enc = reader.ReadByte ();
+			byte fde_count_enc = reader.ReadByte ();
+			byte table_enc = reader.ReadByte ();
+
+			//
+			// We only support the encodings which are used by GNU ld; the
+			// caller falls back to walking the section for everything else.
+			//
+			if ((version != 1) ||
+			    (eh_frame_ptr_enc != (byte) (DW_EH_PE.pcrel | DW_EH_PE.sdata4)) ||
+			    (fde_count_enc != (byte) DW_EH_PE.udata4) ||
+			    (table_enc != (byte) (DW_EH_PE.datarel | DW_EH_PE.sdata4)))
 				return null;
 
-			TargetAddress address = frame.TargetAddress;
+			long eh_frame_ptr = hdr_vma + reader.Position + reader.ReadInt32 ();
+			if (eh_frame_ptr != vma)
+				return null;
+
+			int count = reader.ReadInt32 ();
+			if ((count < 0) || (reader.Position + count * 8 > reader.Size))
+				return null;
+
+			FDEIndexEntry[] index = new FDEIndexEntry [count];
+			for (int i = 0; i < count; i++) {
+				long start = hdr_vma + reader.ReadInt32 ();
+				long fde = hdr_vma + reader.ReadInt32 ();
+				index [i] = new FDEIndexEntry (start, fde - vma);
+			}
+
+			return index;
+		}
+
+		FDEIndexEntry[] build_fde_index (TargetMemoryAccess target)
+		{
+			List<FDEIndexEntry> list = new List<FDEIndexEntry> ();
 
 			DwarfBinaryReader reader = new DwarfBinaryReader (bfd, blob, false);
 
 			while (reader.Position < reader.Size) {
-				long length = reader.ReadInitialLength ();
-				if (length == 0)
+				long offset = reader.Position;
+				if (reader.PeekInt32 (offset) == 0)
 					break;
-				long end_pos = reader.Position + length;
 
-				long cie_pointer = reader.ReadOffset ();
-				bool is_cie;
-				if (is_ehframe)
-					is_cie = cie_pointer == 0;
-				else
-					is_cie = cie_pointer == -1;
+				CIE cie;
+				long initial, range, end_pos;
+				if (read_fde_header (reader, target, out cie, out initial,
+						     out range, out end_pos))
+					list.Add (new FDEIndexEntry (initial, offset));
 
-				if (is_cie) {
-					reader.Position = end_pos;
-					continue;
+				reader.Position = end_pos;
+			}
+
+			FDEIndexEntry[] index = list.ToArray ();
+			Array.Sort (index, delegate (FDEIndexEntry a, FDEIndexEntry b) {
+				return a.Start.CompareTo (b.Start);
+			});
+			return index;
+		}
+
+		void read_fde_index (TargetMemoryAccess target)
+		{
+			if (hdr_blob != null) {
+				try {
+					fde_index = read_eh_frame_hdr ();
+				} catch {
+					fde_index = null;
 				}
+			}
 
-				if (is_ehframe)
-					cie_pointer = reader.Position - cie_pointer -
-						target.TargetMemoryInfo.TargetAddressSize;
+			if (fde_index == null)
+				fde_index = build_fde_index (target);
+		}
 
-				CIE cie = find_cie (cie_pointer);
+		Entry find_entry (TargetAddress address, TargetMemoryAccess target)
+		{
+			if (fde_index == null)
+				read_fde_index (target);
 
-				long initial, range;
-				if (is_ehframe) {
-					initial = ReadEncodedValue (reader, cie.Encoding);
-					range = ReadEncodedValue (reader, cie.Encoding & 0x0f);
-				} else {
-					initial = reader.ReadAddress ();
-					range = reader.ReadAddress ();
-				}
+			long addr = address.Address;
 
-				TargetAddress start = new TargetAddress (target.AddressDomain, initial);
+			int lo = 0, hi = fde_index.Length;
+			while (lo < hi) {
+				int mid = lo + (hi - lo) / 2;
+				if (fde_index [mid].Start <= addr)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
 
-				if ((address < start) || (address > start + range)) {
-					reader.Position = end_pos;
+			//
+			// FDEs shouldn't overlap, but check all the ones which start at or
+			// before the address, nearest first, until one of them covers it.
+			//
+			DwarfBinaryReader reader = new DwarfBinaryReader (bfd, blob, false);
+			for (int i = lo - 1; i >= 0; i--) {
+				reader.Position = fde_index [i].Offset;
+
+				CIE cie;
+				long initial, range, end_pos;
+				if (!read_fde_header (reader, target, out cie, out initial,
+						      out range, out end_pos))
 					continue;
-				}
+
+				if ((addr < initial) || (addr > initial + range))
+					continue;
+
+				TargetAddress start = new TargetAddress (target.AddressDomain, initial);
 
 				Entry fde = new Entry (cie, start, address);
 				fde.Read (reader, end_pos);
-				return fde.Unwind (frame, target, arch);
+				return fde;
 			}
 
 			return null;
 		}
 
+		public StackFrame UnwindStack (StackFrame frame, TargetMemoryAccess target,
+					       Architecture arch)
+		{
+			if (frame.TargetAddress.IsNull)
+				return null;
+
+			TargetAddress address = frame.TargetAddress;
+
+			Entry fde;
+			if (!rule_cache.TryGetValue (address.Address, out fde)) {
+				fde = find_entry (address, target);
+
+				if (rule_cache.Count >= MaxCachedRules)
+					rule_cache.Clear ();
+				rule_cache.Add (address.Address, fde);
+			}
+
+			if (fde == null)
+				return null;
+
+			return fde.Unwind (frame, target, arch);
+		}
+
 		private long ReadEncodedValue (DwarfBinaryReader reader, int encoding)
 		{
 			long base_addr;
@@ -380,7 +543,6 @@ namespace Mono.Debugger.Backend
 		{
 			DwarfFrameReader frame;
 			long offset;
-			CIE next;
 
 			int code_alignment;
 			int data_alignment;
@@ -389,21 +551,16 @@ namespace Mono.Debugger.Backend
 			byte encoding = (byte) DW_EH_PE.udata4;
 			Column[] columns;
 
-			public CIE (DwarfFrameReader frame, long offset, CIE next)
+			public CIE (DwarfFrameReader frame, long offset)
 			{
 				this.frame = frame;
 				this.offset = offset;
-				this.next = next;
 
 				DwarfBinaryReader reader = new DwarfBinaryReader (
 					frame.bfd, frame.blob, false);
 				read_cie (reader);
 			}
 
-			public CIE Next {
-				get { return next; }
-			}
-
 			public Architecture Architecture {
 				get { return frame.bfd.Architecture; }
 			}
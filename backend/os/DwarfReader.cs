@@ -158,12 +158,8 @@ namespace Mono.Debugger.Backend
 			method_hash = Hashtable.Synchronized (new Hashtable ());
 			source_file_hash = Hashtable.Synchronized (new Hashtable ());
 
-			if (bfd.IsLoaded) {
-				aranges = ArrayList.Synchronized (read_aranges ());
-				symtab = new DwarfSymbolTable (this, aranges);
-				pubnames = read_pubnames ();
-				// pubtypes = read_pubtypes ();
-			}
+			if (bfd.IsLoaded)
+				read_index ();
 
 			long offset = 0;
 			while (offset < reader.Size) {
@@ -178,11 +174,101 @@ namespace Mono.Debugger.Backend
 			if (aranges != null)
 				return;
 
-			aranges = ArrayList.Synchronized (read_aranges ());
+			read_index ();
+		}
+
+		void read_index ()
+		{
+			List<ARange> raw_aranges;
+			if (!load_cached_index (out raw_aranges, out pubnames)) {
+				raw_aranges = read_aranges ();
+				pubnames = read_pubnames ();
+				// pubtypes = read_pubtypes ();
+				save_cached_index (raw_aranges, pubnames);
+			}
+
+			ArrayList ranges = new ArrayList (raw_aranges.Count);
+			foreach (ARange range in raw_aranges)
+				ranges.Add (new RangeEntry (
+					this, range.FileOffset, GetAddress (range.Address), range.Size));
+
+			aranges = ArrayList.Synchronized (ranges);
 			symtab = new DwarfSymbolTable (this, aranges);
+		}
+
+		//
+		// .debug_aranges and .debug_pubnames are cached in the SymbolIndexCache;
+		// the format is the list of (offset, address, size) triples followed by
+		// the list of (name, offset, die offset) triples, or -1 if there's no
+		// .debug_pubnames.
+		//
+
+		bool load_cached_index (out List<ARange> raw_aranges, out Hashtable names)
+		{
+			raw_aranges = null;
+			names = null;
+
+			BinaryReader reader = SymbolIndexCache.Open (bfd.BuildID, "dwarf", filename);
+			if (reader == null)
+				return false;
+
+			try {
+				int count = reader.ReadInt32 ();
+				raw_aranges = new List<ARange> (count);
+				for (int i = 0; i < count; i++) {
+					long offset = reader.ReadInt64 ();
+					long address = reader.ReadInt64 ();
+					long size = reader.ReadInt64 ();
+					raw_aranges.Add (new ARange (offset, address, size));
+				}
+
+				count = reader.ReadInt32 ();
+				if (count >= 0) {
+					names = Hashtable.Synchronized (new Hashtable (count));
+					for (int i = 0; i < count; i++) {
+						string name = reader.ReadString ();
+						long file_offset = reader.ReadInt64 ();
+						long offset = reader.ReadInt64 ();
+						names.Add (name, new NameEntry (file_offset, offset));
+					}
+				}
+
+				return true;
+			} catch (Exception ex) {
+				Report.Debug (DebugFlags.DwarfReader,
+					      "Corrupt symbol index for {0}: {1}", filename, ex.Message);
+				SymbolIndexCache.Discard (bfd.BuildID, "dwarf");
+				raw_aranges = null;
+				names = null;
+				return false;
+			} finally {
+				reader.Close ();
+			}
+		}
+
+		void save_cached_index (List<ARange> raw_aranges, Hashtable names)
+		{
+			SymbolIndexCache.Save (bfd.BuildID, "dwarf", filename, delegate (BinaryWriter writer) {
+				writer.Write (raw_aranges.Count);
+				foreach (ARange range in raw_aranges) {
+					writer.Write (range.FileOffset);
+					writer.Write (range.Address);
+					writer.Write (range.Size);
+				}
+
+				if (names == null) {
+					writer.Write (-1);
+					return;
+				}
 
-			pubnames = read_pubnames ();
-			// pubtypes = read_pubtypes ();
+				writer.Write (names.Count);
+				foreach (DictionaryEntry entry in names) {
+					NameEntry name = (NameEntry) entry.Value;
+					writer.Write ((string) entry.Key);
+					writer.Write (name.FileOffset);
+					writer.Write (name.Offset);
+				}
+			});
 		}
 
 		public static bool IsSupported (Bfd bfd)
@@ -576,9 +662,23 @@ namespace Mono.Debugger.Backend
 			}
 		}
 
-		ArrayList read_aranges ()
+		struct ARange
+		{
+			public readonly long FileOffset;
+			public readonly long Address;
+			public readonly long Size;
+
+			public ARange (long file_offset, long address, long size)
+			{
+				this.FileOffset = file_offset;
+				this.Address = address;
+				this.Size = size;
+			}
+		}
+
+		List<ARange> read_aranges ()
 		{
-			ArrayList ranges = new ArrayList ();
+			List<ARange> ranges = new List<ARange> ();
 
 			if (debug_aranges_reader == null)
 				return ranges;
@@ -618,8 +718,7 @@ namespace Mono.Debugger.Backend
 					if ((address == 0) && (size == 0))
 						break;
 
-					TargetAddress taddress = GetAddress (address);
-					ranges.Add (new RangeEntry (this, offset, taddress, size));
+					ranges.Add (new ARange (offset, address, size));
 				}
 			}
 
@@ -723,8 +822,7 @@ namespace Mono.Debugger.Backend
 		object create_reader_func (object user_data)
 		{
 			try {
-				byte[] contents = bfd.GetSectionContents ((string) user_data);
-				return new TargetBlob (contents, bfd.TargetMemoryInfo);
+				return bfd.GetSectionBlob ((string) user_data);
 			} catch {
 				Report.Debug (DebugFlags.DwarfReader,
 					      "{1} Can't find DWARF 2 debugging info in section `{0}'",
@@ -0,0 +1,247 @@
+using System;
+using System.IO;
+using System.Collections.Generic;
+using System.Text;
+
+namespace Mono.Debugger.Backend
+{
+	internal delegate void SymbolIndexWriter (BinaryWriter writer);
+
+	// <summary>
+	//   On-disk cache for the symbol indexes we build while loading a native
+	//   symbol file (the BFD symbol table, .debug_aranges and .debug_pubnames),
+	//   so we don't need to parse them again in the next session.
+	//
+	//   Entries are keyed by the ELF build-id, which changes whenever the binary
+	//   changes; files without a build-id are never cached.  Each entry lives in
+	//   `$XDG_CACHE_HOME/MonoDebugger/SymbolIndex/<build-id>.<kind>' and starts
+	//   with a header which identifies the format version, the kind of index and
+	//   the size of the binary it was created from.  All addresses are stored
+	//   unrelocated.
+	//
+	//   Entries are small compared to the binaries they describe, so we read
+	//   them into memory in one go and decode them; they are not mapped.
+	//
+	//   Set `MDB_SYMBOL_INDEX_CACHE' to `off' to disable the cache or to a
+	//   directory to use instead of the default one.  Once the cache grows
+	//   beyond MaxCacheSize, the least recently written entries are removed.
+	// </summary>
+	internal static class SymbolIndexCache
+	{
+		public const long Magic = 0x58444e494d59534d;	// "MSYMINDX"
+		public const int Version = 1;
+
+		const int EndMarker = 0x21444e45;		// "END!"
+
+		// <summary>
+		//   All the kinds of entries we write; trim_cache() only looks at files
+		//   with one of these extensions.
+		// </summary>
+		static readonly string[] Kinds = { "symtab", "dwarf" };
+
+		public static long MaxCacheSize = 64 * 1024 * 1024;
+
+		static readonly string cache_dir;
+
+		static SymbolIndexCache ()
+		{
+			string var = Environment.GetEnvironmentVariable ("MDB_SYMBOL_INDEX_CACHE");
+			if ((var == "off") || (var == "0"))
+				return;
+			else if ((var != null) && (var != "")) {
+				cache_dir = var;
+				return;
+			}
+
+			string dir = Environment.GetEnvironmentVariable ("XDG_CACHE_HOME");
+			if ((dir == null) || (dir == ""))
+				dir = Path.Combine (
+					Environment.GetFolderPath (Environment.SpecialFolder.Personal),
+					".cache");
+
+			cache_dir = Path.Combine (Path.Combine (dir, "MonoDebugger"), "SymbolIndex");
+		}
+
+		static string get_path (string key, string kind)
+		{
+			return Path.Combine (cache_dir, key + "." + kind);
+		}
+
+		static long get_file_size (string filename)
+		{
+			try {
+				return new FileInfo (filename).Length;
+			} catch {
+				return -1;
+			}
+		}
+
+		// <summary>
+		//   Returns a reader which is positioned at the start of the cached index
+		//   or null if there is no valid entry.
+		// </summary>
+		public static BinaryReader Open (string key, string kind, string filename)
+		{
+			if ((key == null) || (cache_dir == null))
+				return null;
+
+			string path = get_path (key, kind);
+			try {
+				if (!File.Exists (path))
+					return null;
+
+				byte[] contents = File.ReadAllBytes (path);
+				if ((contents.Length < 12) ||
+				    (BitConverter.ToInt32 (contents, contents.Length - 4) != EndMarker)) {
+					Report.Debug (DebugFlags.SymbolTable,
+						      "Truncated symbol index {0}", path);
+					return null;
+				}
+
+				BinaryReader reader = new BinaryReader (
+					new MemoryStream (contents, 0, contents.Length - 4, false),
+					Encoding.UTF8);
+
+				if ((reader.ReadInt64 () != Magic) || (reader.ReadInt32 () != Version) ||
+				    (reader.ReadString () != kind) || (reader.ReadString () != key) ||
+				    (reader.ReadInt64 () != get_file_size (filename))) {
+					Report.Debug (DebugFlags.SymbolTable,
+						      "Stale symbol index {0}", path);
+					return null;
+				}
+
+				Report.Debug (DebugFlags.SymbolTable, "Using symbol index {0} for {1}",
+					      path, filename);
+				return reader;
+			} catch (Exception ex) {
+				Report.Debug (DebugFlags.SymbolTable,
+					      "Can't read symbol index {0}: {1}", path, ex.Message);
+				return null;
+			}
+		}
+
+		// <summary>
+		//   Throw away an entry which Open() accepted, but which turned out to be
+		//   corrupt while reading it.
+		// </summary>
+		public static void Discard (string key, string kind)
+		{
+			if (cache_dir == null)
+				return;
+
+			try {
+				File.Delete (get_path (key, kind));
+			} catch {
+			}
+		}
+
+		public static void Save (string key, string kind, string filename,
+					 SymbolIndexWriter func)
+		{
+			if ((key == null) || (cache_dir == null))
+				return;
+
+			string path = get_path (key, kind);
+			string temp_path = String.Format (
+				"{0}.{1}.tmp", path, System.Diagnostics.Process.GetCurrentProcess ().Id);
+
+			try {
+				if (!Directory.Exists (cache_dir))
+					Directory.CreateDirectory (cache_dir);
+
+				using (FileStream stream = File.Create (temp_path)) {
+					BinaryWriter writer = new BinaryWriter (stream, Encoding.UTF8);
+					writer.Write (Magic);
+					writer.Write (Version);
+					writer.Write (kind);
+					writer.Write (key);
+					writer.Write (get_file_size (filename));
+					func (writer);
+					writer.Write (EndMarker);
+					writer.Flush ();
+				}
+
+				if (File.Exists (path))
+					File.Delete (path);
+				File.Move (temp_path, path);
+
+				trim_cache (path);
+			} catch (Exception ex) {
+				Report.Debug (DebugFlags.SymbolTable,
+					      "Can't write symbol index {0}: {1}", path, ex.Message);
+				try {
+					File.Delete (temp_path);
+				} catch {
+				}
+			}
+		}
+
+		// <summary>
+		//   Whether @file starts with our header, so we know it's one of our
+		//   entries and not something else which happens to live in the cache
+		//   directory.
+		// </summary>
+		static bool is_cache_entry (FileInfo file)
+		{
+			try {
+				using (FileStream stream = file.OpenRead ()) {
+					BinaryReader reader = new BinaryReader (stream);
+					return (stream.Length >= 12) && (reader.ReadInt64 () == Magic);
+				}
+			} catch {
+				return false;
+			}
+		}
+
+		// <summary>
+		//   Remove the oldest entries until the cache is no larger than
+		//   MaxCacheSize; the entry we just wrote at @keep is never removed.
+		//
+		//   We only ever delete finished entries: files named `<key>.<kind>'
+		//   which start with our header.  Temporary files - which may belong
+		//   to a Save() in another session - and anything else in the
+		//   directory are neither counted nor removed.
+		// </summary>
+		static void trim_cache (string keep)
+		{
+			if (MaxCacheSize <= 0)
+				return;
+
+			DirectoryInfo dir = new DirectoryInfo (cache_dir);
+			List<FileInfo> files = new List<FileInfo> ();
+			foreach (string kind in Kinds) {
+				foreach (FileInfo file in dir.GetFiles ("*." + kind)) {
+					if (file.Extension != "." + kind)
+						continue;
+					if (is_cache_entry (file))
+						files.Add (file);
+				}
+			}
+
+			long total = 0;
+			foreach (FileInfo file in files)
+				total += file.Length;
+
+			if (total <= MaxCacheSize)
+				return;
+
+			files.Sort (delegate (FileInfo a, FileInfo b) {
+				return a.LastWriteTimeUtc.CompareTo (b.LastWriteTimeUtc);
+			});
+
+			foreach (FileInfo file in files) {
+				if (total <= MaxCacheSize)
+					break;
+				if (file.FullName == Path.GetFullPath (keep))
+					continue;
+
+				long size = file.Length;
+				try {
+					file.Delete ();
+					total -= size;
+				} catch {
+				}
+			}
+		}
+	}
+}
@@ -32,6 +32,15 @@ namespace Mono.Debugger
 			Deactivate (target);
 		}
 
+		// <summary>
+		//   A simple condition which is evaluated by the debugger server each time
+		//   the breakpoint is hit; the target only stops if it is true.  Must be set
+		//   before the breakpoint is activated.
+		// </summary>
+		public BreakpointCondition Condition {
+			get; set;
+		}
+
 		// <summary>
 		//   Internal breakpoint handler.
 		// </summary>
@@ -0,0 +1,158 @@
+using System;
+
+namespace Mono.Debugger
+{
+	[Serializable]
+	public enum BreakpointConditionOperator
+	{
+		Equal = 0,
+		NotEqual,
+		Less,
+		LessOrEqual,
+		Greater,
+		GreaterOrEqual
+	}
+
+	// <summary>
+	//   A simple breakpoint condition which is evaluated by the debugger server
+	//   right after the target stopped at the breakpoint: a register or memory
+	//   operand compared against a constant, optionally combined with an ignore
+	//   count.  If the condition is false, the server steps over the breakpoint
+	//   and resumes the target without ever stopping it.
+	// </summary>
+	// <remarks>
+	//   All comparisons are signed; memory operands are sign-extended.
+	//   If the server can't evaluate the condition (for instance because it
+	//   can't read the memory), the target stops.
+	// </remarks>
+	[Serializable]
+	public sealed class BreakpointCondition
+	{
+		internal enum ConditionType
+		{
+			None = 0,
+			Register,
+			Memory
+		}
+
+		ConditionType type;
+		BreakpointConditionOperator op;
+		int register = -1;
+		int size;
+		long offset, value;
+
+		// <summary>
+		//   A condition which is always true; use this together with the
+		//   IgnoreCount.
+		// </summary>
+		public BreakpointCondition ()
+		{ }
+
+		BreakpointCondition (ConditionType type, BreakpointConditionOperator op,
+				     int register, int size, long offset, long value)
+		{
+			this.type = type;
+			this.op = op;
+			this.register = register;
+			this.size = size;
+			this.offset = offset;
+			this.value = value;
+		}
+
+		// <summary>
+		//   Compare the contents of @register (an index into the architecture's
+		//   register set) against @value.
+		// </summary>
+		public static BreakpointCondition CompareRegister (int register,
+								   BreakpointConditionOperator op,
+								   long value)
+		{
+			if (register < 0)
+				throw new ArgumentException ();
+
+			return new BreakpointCondition (
+				ConditionType.Register, op, register, 0, 0, value);
+		}
+
+		// <summary>
+		//   Compare the @size bytes at @offset plus the contents of @register
+		//   against @value.  If @register is -1, @offset is an absolute address.
+		// </summary>
+		public static BreakpointCondition CompareMemory (int register, long offset, int size,
+								 BreakpointConditionOperator op,
+								 long value)
+		{
+			if ((size != 1) && (size != 2) && (size != 4) && (size != 8))
+				throw new ArgumentException ();
+
+			return new BreakpointCondition (
+				ConditionType.Memory, op, register, size, offset, value);
+		}
+
+		internal ConditionType Type {
+			get { return type; }
+		}
+
+		public BreakpointConditionOperator Operator {
+			get { return op; }
+		}
+
+		public int Register {
+			get { return register; }
+		}
+
+		public int Size {
+			get { return size; }
+		}
+
+		public long Offset {
+			get { return offset; }
+		}
+
+		public long Value {
+			get { return value; }
+		}
+
+		// <summary>
+		//   Number of times the condition must be true before the breakpoint
+		//   actually stops the target.  The server counts the hits, so this is
+		//   the initial value each time the breakpoint is inserted.
+		// </summary>
+		public int IgnoreCount {
+			get; set;
+		}
+
+		// <summary>
+		//   Counting probes never stop the target; use Process.GetHitCounts()
+		//   to read how often they were hit.
+		// </summary>
+		public bool CountOnly {
+			get; set;
+		}
+
+		// <summary>
+		//   Only stop on every Nth hit; 0 and 1 stop on each hit.
+		// </summary>
+		public int SampleInterval {
+			get; set;
+		}
+
+		// <summary>
+		//   A counting probe; use together with the ThreadGroup to only count
+		//   the hits in one thread.
+		// </summary>
+		public static BreakpointCondition Counter ()
+		{
+			BreakpointCondition condition = new BreakpointCondition ();
+			condition.CountOnly = true;
+			return condition;
+		}
+
+		public override string ToString ()
+		{
+			return String.Format ("BreakpointCondition ({0}:{1}:{2}:{3}:{4}:{5}:{6}:{7}:{8})",
+					      type, op, register, size, offset, value, IgnoreCount,
+					      CountOnly, SampleInterval);
+		}
+	}
+}
@@ -695,6 +695,7 @@ namespace Mono.Debugger
 		{
 			var pending_removals = new List<FunctionBreakpointHandle> ();
 			var pending_inserts = new List<FunctionBreakpointHandle> ();
+			var address_inserts = new List<AddressBreakpointHandle> ();
 
 			lock (this) {
 				if (!reached_main) {
@@ -745,6 +746,14 @@ namespace Mono.Debugger
 							continue;
 
 						FunctionBreakpointHandle fh = handle as FunctionBreakpointHandle;
+						AddressBreakpointHandle ah = handle as AddressBreakpointHandle;
+						if ((ah != null) && (action == BreakpointHandle.Action.Insert) &&
+						    (breakpoint.Type == EventType.Breakpoint)) {
+							// Inserted together below.
+							address_inserts.Add (ah);
+							continue;
+						}
+
 						if (fh == null) {
 							if (action == BreakpointHandle.Action.Insert)
 								handle.Insert (sse.Inferior);
@@ -775,6 +784,22 @@ namespace Mono.Debugger
 							breakpoint.Index, ex.Message);
 					}
 				}
+
+				if (address_inserts.Count > 0) {
+					AddressBreakpointHandle[] handles = address_inserts.ToArray ();
+					TargetException[] errors = AddressBreakpointHandle.Insert (
+						sse.Inferior, handles);
+
+					for (int i = 0; i < handles.Length; i++) {
+						Breakpoint breakpoint = handles [i].Breakpoint;
+						if (errors [i] == null)
+							pending_bpts.Remove (breakpoint);
+						else
+							breakpoint.OnBreakpointError (
+								"Cannot insert breakpoint {0}: {1}",
+								breakpoint.Index, errors [i].Message);
+					}
+				}
 			}
 
 			var pending = new PendingBreakpointQueue ();
@@ -175,6 +175,9 @@ namespace Mono.Debugger
 		{
 			error = null;
 
+			if (property.TryGetValue (thread, instance, out result))
+				return EvaluationResult.Ok;
+
 			RuntimeInvokeResult rti;
 			try {
 				RuntimeInvokeFlags rti_flags = RuntimeInvokeFlags.VirtualMethod;
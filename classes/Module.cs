@@ -53,6 +53,25 @@ namespace Mono.Debugger
 			get;
 		}
 
+		// <summary>
+		//   Whether the symbols are still being read in the background; the
+		//   accessors below block until they're loaded.
+		// </summary>
+		internal virtual bool SymbolsPending {
+			get { return false; }
+		}
+
+		internal virtual void WaitForSymbols ()
+		{ }
+
+		// <summary>
+		//   Whether @address may be inside this symbol file.
+		// </summary>
+		internal virtual bool CoversAddress (TargetAddress address)
+		{
+			return true;
+		}
+
 		public abstract SourceFile[] Sources {
 			get;
 		}
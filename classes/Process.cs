@@ -118,6 +118,35 @@ namespace Mono.Debugger
 			Debugger.OnLeaveNestedBreakState (sse.Client);
 		}
 
+		// <summary>
+		//   Returns how often each of the @breakpoints was hit in this process.
+		//   The counters are maintained by the debugger server and read in one
+		//   go, so this doesn't need to stop the target.
+		// </summary>
+		public long[] GetHitCounts (Breakpoint[] breakpoints)
+		{
+			check_disposed ();
+			return breakpoint_manager.GetHitCounts (breakpoints);
+		}
+
+		// <summary>
+		//   Returns how many slots of the Mono runtime's breakpoint table are
+		//   in use.  Returns false if this isn't a managed application.
+		// </summary>
+		public bool GetRuntimeBreakpointTableUsage (out int used, out int size)
+		{
+			check_disposed ();
+
+			if (mono_manager == null) {
+				used = size = 0;
+				return false;
+			}
+
+			int code_used, code_size;
+			mono_manager.GetRuntimeSlotUsage (out used, out size, out code_used, out code_size);
+			return true;
+		}
+
 		ExceptionCatchPointHandler generic_exc_handler;
 
 		public void InstallGenericExceptionCatchPoint (ExceptionCatchPointHandler handler)
@@ -156,12 +185,14 @@ namespace Mono.Debugger
 		SymbolTableManager symtab_manager;
 		MonoThreadManager mono_manager;
 		BreakpointManager breakpoint_manager;
+		TargetMemoryCache memory_cache;
 		Dictionary<int,ExceptionCatchPoint> exception_handlers;
 		ProcessStart start;
 		DebuggerSession session;
 		MonoLanguageBackend mono_language;
 		ThreadServant main_thread;
 		Hashtable thread_hash;
+		Dictionary<long,SingleSteppingEngine> tid_hash;
 
 		MyOperationHost operation_host;
 
@@ -188,6 +219,9 @@ namespace Mono.Debugger
 			stopped_event = new ST.ManualResetEvent (false);
 
 			thread_hash = Hashtable.Synchronized (new Hashtable ());
+			tid_hash = new Dictionary<long,SingleSteppingEngine> ();
+
+			memory_cache = new TargetMemoryCache ();
 
 			target_info = Inferior.GetTargetInfo ();
 			if (target_info.TargetAddressSize == 8)
@@ -269,6 +303,10 @@ namespace Mono.Debugger
 			get { return breakpoint_manager; }
 		}
 
+		internal TargetMemoryCache MemoryCache {
+			get { return memory_cache; }
+		}
+
 		internal SymbolTableManager SymbolTableManager {
 			get {
 				return symtab_manager;
@@ -399,6 +437,7 @@ namespace Mono.Debugger
 			session.OnProcessExecd (this);
 
 			breakpoint_manager = new BreakpointManager ();
+			memory_cache = new TargetMemoryCache ();
 
 			exception_handlers = new Dictionary<int,ExceptionCatchPoint> ();
 
@@ -510,6 +549,11 @@ namespace Mono.Debugger
 		internal void OnThreadExitedEvent (ThreadServant thread)
 		{
 			thread_hash.Remove (thread.PID);
+			lock (tid_hash) {
+				SingleSteppingEngine engine;
+				if (tid_hash.TryGetValue (thread.TID, out engine) && (engine == thread))
+					tid_hash.Remove (thread.TID);
+			}
 			thread.ThreadGroup.RemoveThread (thread.ID);
 			session.DeleteThreadGroup (thread.ThreadGroup.Name);
 			manager.Debugger.OnThreadExitedEvent (thread.Client);
@@ -562,18 +606,56 @@ namespace Mono.Debugger
 					Report.Error ("Unknown thread {0} in {1}", lwp, start.CommandLine);
 					return;
 				}
-				engine.SetTID (tid);
+				set_tid (engine, tid);
 			});
 		}
 
-		internal bool CheckForThreads (ArrayList check_threads)
+		void set_tid (SingleSteppingEngine engine, long tid)
 		{
-			if(thread_db == null)
-				return false;
+			engine.SetTID (tid);
+			lock (tid_hash) {
+				tid_hash [tid] = engine;
+			}
+		}
+
+		// <summary>
+		//   Only used if the backend doesn't report thread creation and exit (see
+		//   Inferior.HasThreadEvents): returns the engines of all threads which are
+		//   gone or null if nothing changed.
+		//
+		//   New threads show up as events from an unknown pid, so we only need to
+		//   look at the target's thread list through thread_db when the number of
+		//   threads doesn't match what we already know about.
+		// </summary>
+		internal SingleSteppingEngine[] CheckForExitedThreads ()
+		{
+			if (thread_db == null)
+				return null;
+
+			SingleSteppingEngine[] engines;
+			lock (thread_hash.SyncRoot) {
+				engines = new SingleSteppingEngine [thread_hash.Count];
+				thread_hash.Values.CopyTo (engines, 0);
+			}
+
+			if (engines.Length == 0)
+				return null;
+
+			if (engines [0].Inferior.GetThreadCount () == engines.Length)
+				return null;
+
+			Dictionary<int,bool> lwps = new Dictionary<int,bool> ();
 			thread_db.GetThreadInfo (null, delegate (int lwp, long tid) {
-				check_threads.Add(lwp);
-			} );
-			return true;
+				lwps [lwp] = true;
+			});
+
+			List<SingleSteppingEngine> exited = new List<SingleSteppingEngine> ();
+			foreach (SingleSteppingEngine engine in engines) {
+				if (!lwps.ContainsKey (engine.PID))
+					exited.Add (engine);
+			}
+
+			return exited.Count > 0 ? exited.ToArray () : null;
 		}
 
 		void get_thread_info (Inferior inferior, SingleSteppingEngine engine)
@@ -591,7 +673,7 @@ namespace Mono.Debugger
 				if (lwp != engine.PID)
 					return;
 
-				engine.SetTID (tid);
+				set_tid (engine, tid);
 				found = true;
 			});
 
@@ -602,8 +684,10 @@ namespace Mono.Debugger
 
 		internal SingleSteppingEngine GetEngineByTID (Inferior inferior, long tid)
 		{
-			foreach (SingleSteppingEngine engine in thread_hash.Values) {
-				if (engine.TID == tid)
+			lock (tid_hash) {
+				SingleSteppingEngine engine;
+				if (tid_hash.TryGetValue (tid, out engine) && (engine.TID == tid) &&
+				    thread_hash.Contains (engine.PID))
 					return engine;
 			}
 
@@ -618,6 +702,8 @@ namespace Mono.Debugger
 				if (tid != t_tid)
 					return;
 				result = (SingleSteppingEngine) thread_hash [t_lwp];
+				if (result != null)
+					set_tid (result, tid);
 
 			});
 
@@ -761,6 +847,34 @@ namespace Mono.Debugger
 			}
 		}
 
+		// <summary>
+		//   Returns the registers of each of the @threads, which must belong to
+		//   this process, reading them all with one call into the server.  The
+		//   entry for a thread which isn't stopped is null.
+		// </summary>
+		public Registers[] GetRegisters (Thread[] threads)
+		{
+			check_disposed ();
+
+			SingleSteppingEngine[] engines = new SingleSteppingEngine [threads.Length];
+			SingleSteppingEngine sse = null;
+			for (int i = 0; i < threads.Length; i++) {
+				engines [i] = thread_hash [threads [i].PID] as SingleSteppingEngine;
+				if (sse == null)
+					sse = engines [i];
+			}
+
+			if (sse == null)
+				return new Registers [threads.Length];
+
+			if (ThreadManager.InBackgroundThread)
+				return SingleSteppingEngine.GetRegisters (engines);
+
+			return (Registers[]) manager.SendCommand (sse, delegate {
+				return SingleSteppingEngine.GetRegisters (engines);
+			}, null);
+		}
+
 		internal bool HasThreadLock {
 			get { return has_thread_lock; }
 		}
@@ -862,6 +976,8 @@ namespace Mono.Debugger
 			Report.Debug (DebugFlags.Threads,
 				      "Suspending user threads: {0} {1}", model, caller);
 
+			List<SingleSteppingEngine> engines = new List<SingleSteppingEngine> ();
+
 			foreach (SingleSteppingEngine engine in thread_hash.Values) {
 				Report.Debug (DebugFlags.Threads, "  check user thread: {0} {1}",
 					      engine, engine.Thread.ThreadFlags);
@@ -873,7 +989,24 @@ namespace Mono.Debugger
 				if (((engine.Thread.ThreadFlags & Thread.Flags.Daemon) != 0) &&
 				    ((model & ThreadingModel.StopDaemonThreads) == 0))
 					continue;
-				engine.SuspendUserThread ();
+				if (engine.BeginSuspendUserThread ())
+					engines.Add (engine);
+			}
+
+			//
+			// Stop them all at once instead of waiting for each of them in turn.
+			//
+			if (engines.Count > 0) {
+				Inferior[] inferiors = new Inferior [engines.Count];
+				for (int i = 0; i < engines.Count; i++)
+					inferiors [i] = engines [i].Inferior;
+
+				bool[] stopped = new bool [engines.Count];
+				Inferior.ChildEvent[] events = new Inferior.ChildEvent [engines.Count];
+				Inferior.StopAll (inferiors, stopped, events);
+
+				for (int i = 0; i < engines.Count; i++)
+					engines [i].EndSuspendUserThread (stopped [i], events [i]);
 			}
 
 			Report.Debug (DebugFlags.Threads,
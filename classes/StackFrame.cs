@@ -142,18 +142,30 @@ namespace Mono.Debugger
 		}
 
 		internal Registers (Architecture arch, long[] values)
+			: this (arch, values, 0)
+		{
+			if (regs.Length != values.Length)
+				throw new ArgumentException ();
+		}
+
+		// <summary>
+		//   Create the registers from @values [@offset] ... @values [@offset +
+		//   arch.CountRegisters - 1]; used when reading the registers of several
+		//   threads into one buffer.
+		// </summary>
+		internal Registers (Architecture arch, long[] values, int offset)
 		{
 			important_indices = arch.RegisterIndices;
 
 			regs = new Register [arch.CountRegisters];
-			if (regs.Length != values.Length)
+			if (offset + regs.Length > values.Length)
 				throw new ArgumentException ();
 			for (int i = 0; i < regs.Length; i++) {
 				if (arch.RegisterSizes [i] < 0)
 					continue;
 				regs [i] = new Register (
 					this, arch.RegisterNames [i], i,
-					arch.RegisterSizes [i], true, values [i]);
+					arch.RegisterSizes [i], true, values [offset + i]);
 			}
 			from_current_frame = true;
 		}
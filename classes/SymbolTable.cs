@@ -169,10 +169,11 @@ namespace Mono.Debugger
 				return null;
 
 			if (HasRanges) {
-				if (SymbolRanges == null)
+				ISymbolRange[] ranges = SymbolRanges;
+				if (ranges == null)
 					return null;
 
-				foreach (SymbolRangeEntry range in SymbolRanges) {
+				foreach (SymbolRangeEntry range in ranges) {
 					if ((address < range.StartAddress) || (address >= range.EndAddress))
 						continue;
 
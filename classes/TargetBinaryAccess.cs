@@ -1,28 +1,85 @@
 using System;
 using System.Text;
+using System.Runtime.InteropServices;
 
 namespace Mono.Debugger
 {
 	[Serializable]
 	public sealed class TargetBlob
 	{
-		public readonly byte[] Contents;
 		public readonly TargetMemoryInfo TargetMemoryInfo;
 
+		byte[] contents;
+		[NonSerialized] IntPtr data;
+		int size;
+
 		public TargetBlob (byte[] contents, TargetMemoryInfo target_info)
 		{
-			this.Contents = contents;
+			this.contents = contents;
+			this.size = contents.Length;
 			this.TargetMemoryInfo = target_info;
 		}
 
 		public TargetBlob (int size, TargetMemoryInfo target_info)
 		{
-			this.Contents = new byte [size];
+			this.contents = new byte [size];
+			this.size = size;
+			this.TargetMemoryInfo = target_info;
+		}
+
+		// <summary>
+		//   A read-only blob which reads directly from @size bytes of native
+		//   memory at @data - for instance a section which is mmap()ed from
+		//   the symbol file.  The memory must stay around as long as the blob
+		//   is used.
+		// </summary>
+		public TargetBlob (IntPtr data, int size, TargetMemoryInfo target_info)
+		{
+			this.data = data;
+			this.size = size;
 			this.TargetMemoryInfo = target_info;
 		}
 
+		// <summary>
+		//   The blob's contents.  For a blob in native memory, this copies all
+		//   of it into a new array the first time it's called; use the indexer
+		//   and CopyTo() to only read the bytes you need.
+		// </summary>
+		public byte[] Contents {
+			get {
+				if (contents == null) {
+					byte[] copy = new byte [size];
+					Marshal.Copy (data, copy, 0, size);
+					contents = copy;
+				}
+				return contents;
+			}
+		}
+
 		public int Size {
-			get { return Contents.Length; }
+			get { return size; }
+		}
+
+		public byte this [long pos] {
+			get {
+				if (contents != null)
+					return contents [pos];
+				if ((pos < 0) || (pos >= size))
+					throw new IndexOutOfRangeException ();
+				return Marshal.ReadByte (data, (int) pos);
+			}
+		}
+
+		public void CopyTo (long pos, byte[] buffer, int offset, int count)
+		{
+			if (contents != null) {
+				Array.Copy (contents, (int) pos, buffer, offset, count);
+				return;
+			}
+
+			if ((pos < 0) || (count < 0) || (pos + count > size))
+				throw new ArgumentOutOfRangeException ();
+			Marshal.Copy ((IntPtr) (data.ToInt64 () + pos), buffer, offset, count);
 		}
 
 		public TargetBinaryReader GetReader ()
@@ -63,7 +120,7 @@ namespace Mono.Debugger
 
 		public long Size {
 			get {
-				return blob.Contents.Length;
+				return blob.Size;
 			}
 		}
 
@@ -79,7 +136,7 @@ namespace Mono.Debugger
 
 		public bool IsEof {
 			get {
-				return pos == blob.Contents.Length;
+				return pos == blob.Size;
 			}
 		}
 
@@ -19,37 +19,37 @@ namespace Mono.Debugger
 
 		public byte PeekByte (long pos)
 		{
-			return blob.Contents[pos];
+			return blob [pos];
 		}
 
 		public byte PeekByte ()
 		{
-			return blob.Contents[pos];
+			return blob [pos];
 		}
 
 		public byte ReadByte ()
 		{
-			return blob.Contents[pos++];
+			return blob [pos++];
 		}
 
 		public sbyte PeekSByte ()
 		{
-			return (sbyte) blob.Contents[pos];
+			return (sbyte) blob [pos];
 		}
 
 		public sbyte ReadSByte ()
 		{
-			return (sbyte) blob.Contents[pos++];
+			return (sbyte) blob [pos++];
 		}
 
 		public short PeekInt16 (long pos)
 		{
 			if (swap)
-				return ((short) (blob.Contents[pos+1] |
-						 (blob.Contents[pos] << 8)));
+				return ((short) (blob [pos+1] |
+						 (blob [pos] << 8)));
 			else
-				return ((short) (blob.Contents[pos] |
-						 (blob.Contents[pos+1] << 8)));
+				return ((short) (blob [pos] |
+						 (blob [pos+1] << 8)));
 		}
 
 		public short PeekInt16 ()
@@ -67,15 +67,15 @@ namespace Mono.Debugger
 		public int PeekInt32 (long pos)
 		{
 			if (swap)
-				return (blob.Contents[pos+3] |
-					(blob.Contents[pos+2] << 8) |
-					(blob.Contents[pos+1] << 16) |
-					(blob.Contents[pos] << 24));
+				return (blob [pos+3] |
+					(blob [pos+2] << 8) |
+					(blob [pos+1] << 16) |
+					(blob [pos] << 24));
 			else
-				return (blob.Contents[pos] |
-					(blob.Contents[pos+1] << 8) |
-					(blob.Contents[pos+2] << 16) |
-					(blob.Contents[pos+3] << 24));
+				return (blob [pos] |
+					(blob [pos+1] << 8) |
+					(blob [pos+2] << 16) |
+					(blob [pos+3] << 24));
 		}
 
 		public int PeekInt32 ()
@@ -93,15 +93,15 @@ namespace Mono.Debugger
 		public uint PeekUInt32 (long pos)
 		{
 			if (swap)
-				return ((uint) blob.Contents[pos+3] |
-					((uint) blob.Contents[pos+2] << 8) |
-					((uint) blob.Contents[pos+1] << 16) |
-					((uint) blob.Contents[pos] << 24));
+				return ((uint) blob [pos+3] |
+					((uint) blob [pos+2] << 8) |
+					((uint) blob [pos+1] << 16) |
+					((uint) blob [pos] << 24));
 			else
-				return ((uint) blob.Contents[pos] |
-					((uint) blob.Contents[pos+1] << 8) |
-					((uint) blob.Contents[pos+2] << 16) |
-					((uint) blob.Contents[pos+3] << 24));
+				return ((uint) blob [pos] |
+					((uint) blob [pos+1] << 8) |
+					((uint) blob [pos+2] << 16) |
+					((uint) blob [pos+3] << 24));
 		}
 
 		public uint PeekUInt32 ()
@@ -120,23 +120,23 @@ namespace Mono.Debugger
 		{
 			uint ret_low, ret_high;
 			if (swap) {
-				ret_low  = (uint) (blob.Contents[pos+7]           |
-						   (blob.Contents[pos+6] << 8)  |
-						   (blob.Contents[pos+5] << 16) |
-						   (blob.Contents[pos+4] << 24));
-				ret_high = (uint) (blob.Contents[pos+3]         |
-						   (blob.Contents[pos+2] << 8)  |
-						   (blob.Contents[pos+1] << 16) |
-						   (blob.Contents[pos] << 24));
+				ret_low  = (uint) (blob [pos+7]           |
+						   (blob [pos+6] << 8)  |
+						   (blob [pos+5] << 16) |
+						   (blob [pos+4] << 24));
+				ret_high = (uint) (blob [pos+3]         |
+						   (blob [pos+2] << 8)  |
+						   (blob [pos+1] << 16) |
+						   (blob [pos] << 24));
 			} else {
-				ret_low  = (uint) (blob.Contents[pos]           |
-						   (blob.Contents[pos+1] << 8)  |
-						   (blob.Contents[pos+2] << 16) |
-						   (blob.Contents[pos+3] << 24));
-				ret_high = (uint) (blob.Contents[pos+4]         |
-						   (blob.Contents[pos+5] << 8)  |
-						   (blob.Contents[pos+6] << 16) |
-						   (blob.Contents[pos+7] << 24));
+				ret_low  = (uint) (blob [pos]           |
+						   (blob [pos+1] << 8)  |
+						   (blob [pos+2] << 16) |
+						   (blob [pos+3] << 24));
+				ret_high = (uint) (blob [pos+4]         |
+						   (blob [pos+5] << 8)  |
+						   (blob [pos+6] << 16) |
+						   (blob [pos+7] << 24));
 			}
 			return (long) ((((ulong) ret_high) << 32) | ret_low);
 		}
@@ -182,12 +182,12 @@ namespace Mono.Debugger
 		public string PeekString (long pos)
 		{
 			int length = 0;
-			while (blob.Contents[pos+length] != 0)
+			while (blob [pos+length] != 0)
 				length++;
 
 			char[] retval = new char [length];
 			for (int i = 0; i < length; i++)
-				retval [i] = (char) blob.Contents[pos+i];
+				retval [i] = (char) blob [pos+i];
 
 			return new String (retval);
 		}
@@ -208,7 +208,7 @@ namespace Mono.Debugger
 		{
 			byte[] buffer = new byte [size];
 
-			Array.Copy (blob.Contents, (int) offset, buffer, 0, size);
+			blob.CopyTo (offset, buffer, 0, size);
 
 			return buffer;
 		}
@@ -222,7 +222,7 @@ namespace Mono.Debugger
 		{
 			byte[] buffer = new byte [size];
 
-			Array.Copy (blob.Contents, pos, buffer, 0, size);
+			blob.CopyTo (pos, buffer, 0, size);
 			pos += size;
 
 			return buffer;
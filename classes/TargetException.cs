@@ -24,6 +24,7 @@ namespace Mono.Debugger
 		IOError,
 		NoCallbackFrame,
 		PermissionDenied,
+		DisplacementOutOfRange,
 
 		NoStack			= 101,
 		NoMethod,
@@ -118,6 +119,8 @@ namespace Mono.Debugger
 				return "Operation not permitted outside managed context.";
 			case TargetError.PermissionDenied:
 				return "Permission denied.";
+			case TargetError.DisplacementOutOfRange:
+				return "Cannot move IP-relative instruction out of line.";
 			default:
 				return "Unknown error";
 			}
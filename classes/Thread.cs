@@ -738,6 +738,12 @@ namespace Mono.Debugger
 			return servant.ReadBuffer (address, size);
 		}
 
+		public byte[][] ReadBuffers (TargetAddress[] addresses, int[] sizes)
+		{
+			check_alive ();
+			return servant.ReadBuffers (addresses, sizes);
+		}
+
 		public bool CanWrite {
 			get {
 				check_servant ();
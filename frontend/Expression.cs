@@ -21,6 +21,7 @@ namespace Mono.Debugger.Frontend
 
 		protected virtual TargetType DoEvaluateType (ScriptingContext context)
 		{
+			context.CaptureTargetObject ();
 			return EvaluateObject (context).Type;
 		}
 
@@ -588,6 +589,7 @@ namespace Mono.Debugger.Frontend
 			if (exc == null)
 				throw new ScriptingException ("No current exception.");
 
+			context.CaptureTargetObject ();
 			resolved = true;
 			return this;
 		}
@@ -728,7 +730,7 @@ namespace Mono.Debugger.Frontend
                         return String.Concat (nsn, ".", name);
                 }
 
-		TargetVariable GetVariableByName (StackFrame frame, string name)
+		internal static TargetVariable GetVariableByName (StackFrame frame, string name)
 		{
 			TargetVariable[] locals = frame.Method.GetLocalVariables (frame.Thread);
 			foreach (TargetVariable var in locals) {
@@ -784,6 +786,9 @@ namespace Mono.Debugger.Frontend
 			if (member == null)
 				return null;
 
+			if (instance != null)
+				context.CaptureTargetObject ();
+
 			return member;
 		}
 
@@ -813,6 +818,7 @@ namespace Mono.Debugger.Frontend
 				StackFrame frame = context.CurrentFrame;
 				if ((frame.Method != null) && frame.Method.IsLoaded) {
 					TargetVariable var = GetVariableByName (frame, name);
+					context.CaptureLocal (name, var);
 					if (var != null)
 						return new VariableAccessExpression (var);
 				}
@@ -825,20 +831,25 @@ namespace Mono.Debugger.Frontend
 				if (!address.IsNull)
 					return new NumberExpression (address.Address);
 			} else if (context.ImplicitInstance != null) {
+				TargetStructType itype = context.ImplicitInstance.Type;
+				Expression iexpr = new ImplicitInstanceExpression ();
+
 				MemberExpression member = StructAccessExpression.FindMember (
-					context.CurrentThread, context.ImplicitInstance.Type,
+					context.CurrentThread, itype,
 					context.ImplicitInstance, name, true, true);
 				if (member != null)
-					return member;
+					return InstanceMemberAccessExpression.Create (
+						context, iexpr, itype, name, member);
 
 				string[] namespaces = context.GetNamespaces () ?? new string [0];
 				foreach (string ns in namespaces) {
 					string full_name = MakeFQN (ns, name);
 					member = StructAccessExpression.FindMember (
-						context.CurrentThread, context.ImplicitInstance.Type,
+						context.CurrentThread, itype,
 						context.ImplicitInstance, full_name, true, true);
 					if (member != null)
-						return member;
+						return InstanceMemberAccessExpression.Create (
+							context, iexpr, itype, full_name, member);
 				}
 			}
 
@@ -1036,7 +1047,13 @@ namespace Mono.Debugger.Frontend
 						"instance reference; use a type name instead.",
 						sobj.Type.Name, name);
 
-				return member;
+				if (for_invocation) {
+					context.CaptureTargetObject ();
+					return member;
+				}
+
+				return InstanceMemberAccessExpression.Create (
+					context, lexpr, sobj.Type, name, member);
 			}
 
 			Expression ltype = left.TryResolveType (context);
@@ -1127,6 +1144,146 @@ namespace Mono.Debugger.Frontend
 		}
 	}
 
+	// <summary>
+	//   An instance field or property which is accessed through another
+	//   expression - `foo.bar' or a member of the ScriptingContext's implicit
+	//   instance.
+	//
+	//   Unlike a StructAccessExpression, this doesn't hold on to the instance it
+	//   was resolved against, but evaluates `left' again each time, so the
+	//   resolved tree can be kept in the ExpressionCache.  As long as the
+	//   instance still has the same type, we reuse the member we found while
+	//   resolving; otherwise, we look it up again.
+	// </summary>
+	public class InstanceMemberAccessExpression : MemberExpression
+	{
+		Expression left;
+		string name;
+		TargetStructType instance_type;
+		StructAccessExpression member;
+
+		protected InstanceMemberAccessExpression (Expression left, string name,
+							  TargetStructType instance_type,
+							  StructAccessExpression member)
+		{
+			this.left = left;
+			this.name = name;
+			this.instance_type = instance_type;
+			this.member = member;
+			resolved = true;
+		}
+
+		// <summary>
+		//   Only used while the ExpressionCache is resolving an expression;
+		//   otherwise, we just return the @member we already have.
+		// </summary>
+		internal static MemberExpression Create (ScriptingContext context, Expression left,
+							 TargetStructType instance_type, string name,
+							 MemberExpression member)
+		{
+			if (context.Compilation == null)
+				return member;
+
+			StructAccessExpression sexpr = member as StructAccessExpression;
+			if (sexpr == null) {
+				context.CaptureTargetObject ();
+				return member;
+			}
+
+			if (sexpr.IsStatic)
+				return member;
+
+			return new InstanceMemberAccessExpression (
+				left, name, instance_type, sexpr);
+		}
+
+		public override string Name {
+			get { return left.Name + "." + name; }
+		}
+
+		public override TargetStructObject InstanceObject {
+			get { return null; }
+		}
+
+		public override bool IsInstance {
+			get { return true; }
+		}
+
+		public override bool IsStatic {
+			get { return false; }
+		}
+
+		protected StructAccessExpression GetMember (ScriptingContext context)
+		{
+			Thread target = context.CurrentThread;
+
+			TargetClassObject sobj = Convert.ToStructObject (
+				target, left.EvaluateObject (context));
+			if (sobj == null)
+				throw new ScriptingException (
+					"`{0}' is not a struct or class", left.Name);
+
+			if (sobj.Type == instance_type)
+				return new StructAccessExpression (member.Type, sobj, member.Member);
+
+			StructAccessExpression sexpr = StructAccessExpression.FindMember (
+				target, sobj.Type, sobj, name, true, true) as StructAccessExpression;
+			if ((sexpr == null) || !sexpr.IsInstance)
+				throw new ScriptingException (
+					"Type `{0}' has no instance field or property `{1}'",
+					sobj.Type.Name, name);
+
+			return sexpr;
+		}
+
+		protected override Expression DoResolve (ScriptingContext context)
+		{
+			return this;
+		}
+
+		protected override TargetType DoEvaluateType (ScriptingContext context)
+		{
+			return GetMember (context).EvaluateType (context);
+		}
+
+		protected override TargetObject DoEvaluateObject (ScriptingContext context)
+		{
+			return GetMember (context).EvaluateObject (context);
+		}
+
+		protected override bool DoAssign (ScriptingContext context, TargetObject obj)
+		{
+			GetMember (context).Assign (context, obj);
+			return true;
+		}
+	}
+
+	// <summary>
+	//   The ScriptingContext's implicit instance, which is where we look up
+	//   the names in a [DebuggerDisplay] attribute.
+	// </summary>
+	internal class ImplicitInstanceExpression : Expression
+	{
+		public ImplicitInstanceExpression ()
+		{
+			resolved = true;
+		}
+
+		public override string Name {
+			get { return "this"; }
+		}
+
+		protected override Expression DoResolve (ScriptingContext context)
+		{
+			return this;
+		}
+
+		protected override TargetObject DoEvaluateObject (ScriptingContext context)
+		{
+			return context.ImplicitInstance;
+		}
+	}
+
 	public abstract class MethodExpression : MemberExpression
 	{
 		protected abstract SourceLocation DoEvaluateSource (ScriptingContext context);
@@ -1671,6 +1828,10 @@ namespace Mono.Debugger.Frontend
 		protected TargetObject GetProperty (ScriptingContext context,
 						    TargetPropertyInfo prop)
 		{
+			TargetObject value;
+			if (prop.TryGetValue (context.CurrentThread, InstanceObject, out value))
+				return value;
+
 			RuntimeInvokeFlags flags = context.GetRuntimeInvokeFlags ();
 
 			RuntimeInvokeResult result = context.RuntimeInvoke (
@@ -2941,6 +3102,9 @@ namespace Mono.Debugger.Frontend
 
 			TargetFunctionType[] methods = new TargetFunctionType[] { invoke };
 
+			if (cobj != null)
+				context.CaptureTargetObject ();
+
 			MethodGroupExpression mg = new MethodGroupExpression (
 				ctype, cobj, "Invoke", methods, true, false);
 			return mg;
@@ -3287,6 +3451,8 @@ namespace Mono.Debugger.Frontend
 			if (type == null)
 				return null;
 
+			context.CaptureTargetObject ();
+
 			Expression[] args = { new ArgumentExpression (instance) };
 			NewExpression expr = new NewExpression (new TypeExpression (type), args);
 
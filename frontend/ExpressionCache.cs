@@ -0,0 +1,191 @@
+using System;
+using System.Collections.Generic;
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+
+namespace Mono.Debugger.Frontend
+{
+	// <summary>
+	//   Keeps resolved expression trees around, so an expression which is
+	//   evaluated on each stop - like a display - doesn't need to be parsed and
+	//   resolved again each time.
+	//
+	//   A resolved tree already holds everything that the lookup found: the
+	//   TargetVariables with their locations, the TargetMemberInfos of the
+	//   fields and the overload-resolved methods.  Evaluating it again only
+	//   needs to read the target.
+	//
+	//   Entries are keyed by the expression text, the language and the scope the
+	//   expression was resolved in - the method of the current frame or the
+	//   type of the implicit instance.  Resolving may also depend on the frame's
+	//   address (local variables are looked up by scope), so we record which
+	//   variable each simple name resolved to and check that it still does.
+	//
+	//   Trees which hold on to a target object (`this', the current exception,
+	//   an instance which was looked up while resolving) are never cached.
+	// </summary>
+	internal class ExpressionCache
+	{
+		public const int MaxEntries = 256;
+
+		Dictionary<Key,Entry> entries = new Dictionary<Key,Entry> ();
+
+		// <summary>
+		//   Returns the cached resolved tree for @text or null.
+		// </summary>
+		public Expression Lookup (ScriptingContext context, string text)
+		{
+			Key key = GetKey (context, text);
+			if (key == null)
+				return null;
+
+			Entry entry;
+			lock (this) {
+				if (!entries.TryGetValue (key, out entry))
+					return null;
+			}
+
+			if (!entry.IsValid (context))
+				return null;
+
+			return entry.Expression;
+		}
+
+		// <summary>
+		//   Resolves @expr, which has been parsed from @text, and adds it to the
+		//   cache if the resolved tree can be reused.
+		// </summary>
+		public Expression Resolve (ScriptingContext context, string text, Expression expr)
+		{
+			Key key = GetKey (context, text);
+			if (key == null)
+				return expr.Resolve (context);
+
+			Compilation compilation = new Compilation ();
+			Compilation old_compilation = context.Compilation;
+
+			Expression resolved;
+			try {
+				context.Compilation = compilation;
+				resolved = expr.Resolve (context);
+			} finally {
+				context.Compilation = old_compilation;
+			}
+
+			if (compilation.UsesTargetObjects)
+				return resolved;
+
+			lock (this) {
+				if (entries.Count >= MaxEntries)
+					entries.Clear ();
+				entries [key] = new Entry (resolved, compilation.Locals);
+			}
+
+			return resolved;
+		}
+
+		public void Flush ()
+		{
+			lock (this) {
+				entries.Clear ();
+			}
+		}
+
+		static Key GetKey (ScriptingContext context, string text)
+		{
+			object scope;
+			if (context.HasFrame) {
+				Method method = context.CurrentFrame.Method;
+				if ((method == null) || !method.IsLoaded)
+					return null;
+				scope = method;
+			} else if (context.ImplicitInstance != null)
+				scope = context.ImplicitInstance.Type;
+			else
+				return null;
+
+			Language language;
+			try {
+				language = context.CurrentLanguage;
+			} catch (ScriptingException) {
+				return null;
+			}
+
+			return new Key (text, scope, language);
+		}
+
+		// <summary>
+		//   Collects everything the resolved tree depends on while
+		//   ExpressionCache.Resolve() is running; see
+		//   ScriptingContext.Compilation.
+		// </summary>
+		internal class Compilation
+		{
+			public bool UsesTargetObjects;
+			public readonly List<KeyValuePair<string,TargetVariable>> Locals =
+				new List<KeyValuePair<string,TargetVariable>> ();
+
+			public void AddLocal (string name, TargetVariable var)
+			{
+				Locals.Add (new KeyValuePair<string,TargetVariable> (name, var));
+			}
+		}
+
+		class Key
+		{
+			public readonly string Text;
+			public readonly object Scope;
+			public readonly Language Language;
+
+			public Key (string text, object scope, Language language)
+			{
+				this.Text = text;
+				this.Scope = scope;
+				this.Language = language;
+			}
+
+			public override bool Equals (object o)
+			{
+				Key key = o as Key;
+				if (key == null)
+					return false;
+
+				return (key.Text == Text) && (key.Scope == Scope) &&
+					(key.Language == Language);
+			}
+
+			public override int GetHashCode ()
+			{
+				return Text.GetHashCode () ^ Scope.GetHashCode ();
+			}
+		}
+
+		class Entry
+		{
+			public readonly Expression Expression;
+			KeyValuePair<string,TargetVariable>[] locals;
+
+			public Entry (Expression expr, List<KeyValuePair<string,TargetVariable>> locals)
+			{
+				this.Expression = expr;
+				this.locals = locals.ToArray ();
+			}
+
+			public bool IsValid (ScriptingContext context)
+			{
+				if (locals.Length == 0)
+					return true;
+
+				StackFrame frame = context.CurrentFrame;
+				foreach (KeyValuePair<string,TargetVariable> local in locals) {
+					TargetVariable var = SimpleNameExpression.GetVariableByName (
+						frame, local.Key);
+					if (var != local.Value)
+						return false;
+				}
+
+				return true;
+			}
+		}
+	}
+}
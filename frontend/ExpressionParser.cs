@@ -24,11 +24,16 @@ namespace Mono.Debugger.Frontend
 			get; private set;
 		}
 
+		internal ExpressionCache Cache {
+			get; private set;
+		}
+
 		private readonly CSharp.ExpressionParser parser;
 
 		internal ExpressionParser (Interpreter interpreter)
 		{
 			this.Interpreter = interpreter;
+			this.Cache = new ExpressionCache ();
 
 			parser = new CSharp.ExpressionParser ("C#");
 		}
@@ -150,15 +155,19 @@ namespace Mono.Debugger.Frontend
 		public string EvaluateExpression (ScriptingContext context, string text,
 						  DisplayFormat format)
 		{
-			F.Expression expression = context.ParseExpression (text);
+			F.Expression expression = Cache.Lookup (context, text);
 
-			try {
-				expression = expression.Resolve (context);
-			} catch (ScriptingException ex) {
-				throw new ScriptingException ("Cannot resolve expression `{0}': {1}",
-							      text, ex.Message);
-			} catch {
-				throw new ScriptingException ("Cannot resolve expression `{0}'.", text);
+			if (expression == null) {
+				expression = context.ParseExpression (text);
+
+				try {
+					expression = Cache.Resolve (context, text, expression);
+				} catch (ScriptingException ex) {
+					throw new ScriptingException ("Cannot resolve expression `{0}': {1}",
+								      text, ex.Message);
+				} catch {
+					throw new ScriptingException ("Cannot resolve expression `{0}'.", text);
+				}
 			}
 
 			try {
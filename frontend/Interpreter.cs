@@ -504,6 +504,7 @@ namespace Mono.Debugger.Frontend
 
 		protected virtual void OnProcessExited (Process process)
 		{
+			parser.Cache.Flush ();
 			Print ("Process #{0} exited.", process.ID);
 			if (process == main_process) {
 				current_process = main_process = null;
@@ -539,8 +540,14 @@ namespace Mono.Debugger.Frontend
 			}
 		}
 
+		protected virtual void OnModuleChanged (Module module)
+		{
+			parser.Cache.Flush ();
+		}
+
 		protected virtual void OnTargetExited ()
 		{
+			parser.Cache.Flush ();
 			debugger = null;
 			main_process = current_process = null;
 			current_thread = null;
@@ -910,6 +917,8 @@ namespace Mono.Debugger.Frontend
 				debugger.ProcessExitedEvent += process_exited;
 				debugger.ProcessExecdEvent += process_execd;
 				debugger.TargetEvent += target_event;
+				debugger.ModuleLoadedEvent += module_changed;
+				debugger.ModuleUnLoadedEvent += module_changed;
 				debugger.EnterNestedBreakStateEvent +=
 					delegate (Debugger unused, Thread thread) {
 						interpreter.OnEnterNestedBreakState (thread);
@@ -976,6 +985,11 @@ namespace Mono.Debugger.Frontend
 			{
 				interpreter.OnTargetExited ();
 			}
+
+			public void module_changed (Module module)
+			{
+				interpreter.OnModuleChanged (module);
+			}
 		}
 
 		protected class ProcessEventSink : DebuggerMarshalByRefObject
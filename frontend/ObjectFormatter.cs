@@ -14,6 +14,19 @@ namespace Mono.Debugger.Frontend
 		public static int Columns = 75;
 		public static bool WrapLines = true;
 
+		// <summary>
+		//   Huge arrays and strings are read from the target in pages of this
+		//   many elements or characters.
+		// </summary>
+		public static int PageSize = 1024;
+
+		// <summary>
+		//   Stop after this many array elements and this many characters of a
+		//   string; 0 means no limit.
+		// </summary>
+		public static int MaxArrayElements = 1000;
+		public static int MaxStringLength = 10000;
+
 		StringBuilder sb = new StringBuilder ();
 
 		public ObjectFormatter (DisplayFormat format)
@@ -152,6 +165,11 @@ namespace Mono.Debugger.Frontend
 					break;
 
 				case TargetObjectKind.Fundamental:
+					if (obj is TargetStringObject) {
+						FormatString (target, (TargetStringObject) obj);
+						break;
+					}
+
 					TargetFundamentalObject fobj = (TargetFundamentalObject) obj;
 					object value = fobj.GetObject (target);
 					Format (target, value);
@@ -210,6 +228,11 @@ namespace Mono.Debugger.Frontend
 				break;
 
 			case TargetObjectKind.Fundamental: {
+				if (obj is TargetStringObject) {
+					FormatString (target, (TargetStringObject) obj);
+					break;
+				}
+
 				object value = ((TargetFundamentalObject) obj).GetObject (target);
 				Format (target, value);
 				break;
@@ -351,12 +374,31 @@ namespace Mono.Debugger.Frontend
 		protected void FormatArray (Thread target, TargetArrayObject aobj)
 		{
 			TargetArrayBounds bounds = aobj.GetArrayBounds (target);
-			if (bounds.IsUnbound)
+			if (bounds.IsUnbound) {
 				Append ("[ ]");
-			else
+				return;
+			}
+
+			if (in_array) {
+				FormatArray (target, aobj, bounds, 0, new int [0]);
+				return;
+			}
+
+			//
+			// Nested arrays share the limit of the outermost one.
+			//
+			try {
+				in_array = true;
+				elements_left = MaxArrayElements > 0 ? MaxArrayElements : -1;
 				FormatArray (target, aobj, bounds, 0, new int [0]);
+			} finally {
+				in_array = false;
+			}
 		}
 
+		bool in_array;
+		int elements_left = -1;
+
 		protected void FormatArray (Thread target, TargetArrayObject aobj,
 					    TargetArrayBounds bounds, int dimension,
 					    int[] indices)
@@ -378,19 +420,47 @@ namespace Mono.Debugger.Frontend
 				upper = bounds.UpperBounds [dimension];
 			}
 
-			for (int i = lower; i <= upper; i++) {
+			for (int i = lower; i <= upper; ) {
 				if (!first) {
 					Append (", ");
 					CheckLineWrap ();
 				}
 				first = false;
 
+				if (elements_left == 0) {
+					Append ("... ({0} more)", upper - i + 1);
+					break;
+				}
+
 				new_indices [dimension] = i;
-				if (dimension + 1 < bounds.Rank)
+				if (dimension + 1 < bounds.Rank) {
 					FormatArray (target, aobj, bounds, dimension + 1, new_indices);
-				else {
-					TargetObject eobj = aobj.GetElement (target, new_indices);
-					FormatObjectRecursed (target, eobj, false);
+					i++;
+					continue;
+				}
+
+				int count = upper - i + 1;
+				if (PageSize > 0)
+					count = Math.Min (count, PageSize);
+				if (elements_left > 0)
+					count = Math.Min (count, elements_left);
+
+				//
+				// An element which is an array itself - in a jagged array -
+				// doesn't count against the limit, only its elements do.
+				//
+				TargetObject[] elements = aobj.GetElements (target, new_indices, count);
+				for (int j = 0; j < count; j++) {
+					if (j > 0) {
+						if (elements_left == 0)
+							break;
+						Append (", ");
+						CheckLineWrap ();
+					}
+					FormatObjectRecursed (target, elements [j], false);
+					if ((elements_left > 0) && !(elements [j] is TargetArrayObject))
+						elements_left--;
+					i++;
 				}
 			}
 
@@ -398,6 +468,24 @@ namespace Mono.Debugger.Frontend
 			indent_level -= 3;
 		}
 
+		protected void FormatString (Thread target, TargetStringObject sobj)
+		{
+			int length = sobj.GetLength (target);
+			int max = length;
+			if ((MaxStringLength > 0) && (max > MaxStringLength))
+				max = MaxStringLength;
+
+			int page = PageSize > 0 ? PageSize : max;
+
+			Append ("\"");
+			for (int start = 0; start < max; start += page)
+				Append (sobj.GetSubstring (target, start, Math.Min (page, max - start)));
+			Append ("\"");
+
+			if (max < length)
+				Append (" ... ({0} more)", length - max);
+		}
+
 		protected void PrintObject (Thread target, TargetObject obj)
 		{
 			try {
@@ -232,6 +232,29 @@ namespace Mono.Debugger.Frontend
 			get; private set;
 		}
 
+		// <summary>
+		//   Set while ExpressionCache.Resolve() is resolving an expression.
+		// </summary>
+		internal ExpressionCache.Compilation Compilation {
+			get; set;
+		}
+
+		// <summary>
+		//   Called while resolving an expression if the resolved tree holds on
+		//   to a target object, so it can't be cached.
+		// </summary>
+		internal void CaptureTargetObject ()
+		{
+			if (Compilation != null)
+				Compilation.UsesTargetObjects = true;
+		}
+
+		internal void CaptureLocal (string name, TargetVariable var)
+		{
+			if (Compilation != null)
+				Compilation.AddLocal (name, var);
+		}
+
 		public void Print (string message)
 		{
 			interpreter.Print (message);
@@ -341,24 +364,27 @@ namespace Mono.Debugger.Frontend
 					expr_text.Append (attr_value [pos++]);
 				}
 
-				Expression expr;
+				ExpressionCache cache = Interpreter.ExpressionParser.Cache;
+				Expression expr = cache.Lookup (this, expr_text.ToString ());
 
-				try {
-					expr = Interpreter.ExpressionParser.ParseInternal (expr_text.ToString ());
-				} catch (ExpressionParsingException ex) {
-					result = ex.Message;
-					return EE.EvaluationResult.InvalidExpression;
-				} catch {
-					return EE.EvaluationResult.InvalidExpression;
-				}
+				if (expr == null) {
+					try {
+						expr = Interpreter.ExpressionParser.ParseInternal (expr_text.ToString ());
+					} catch (ExpressionParsingException ex) {
+						result = ex.Message;
+						return EE.EvaluationResult.InvalidExpression;
+					} catch {
+						return EE.EvaluationResult.InvalidExpression;
+					}
 
-				try {
-					expr = expr.Resolve (this);
-				} catch (ScriptingException ex) {
-					result = ex.Message;
-					return EE.EvaluationResult.InvalidExpression;
-				} catch {
-					return EE.EvaluationResult.InvalidExpression;
+					try {
+						expr = cache.Resolve (this, expr_text.ToString (), expr);
+					} catch (ScriptingException ex) {
+						result = ex.Message;
+						return EE.EvaluationResult.InvalidExpression;
+					} catch {
+						return EE.EvaluationResult.InvalidExpression;
+					}
 				}
 
 				string text;
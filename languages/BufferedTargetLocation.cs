@@ -0,0 +1,63 @@
+using System;
+
+using Mono.Debugger.Backend;
+
+namespace Mono.Debugger.Languages
+{
+	// <summary>
+	//   A location in the target whose contents have already been read as
+	//   part of a larger block - like an element of an array page.  Reads are
+	//   served from that copy; writes go to the target and update the copy.
+	// </summary>
+	internal class BufferedTargetLocation : TargetLocation
+	{
+		TargetAddress address;
+		TargetBlob blob;
+		int offset;
+
+		public BufferedTargetLocation (TargetAddress address, TargetBlob blob, int offset)
+		{
+			this.address = address;
+			this.blob = blob;
+			this.offset = offset;
+		}
+
+		internal override bool HasAddress {
+			get { return true; }
+		}
+
+		internal override TargetAddress GetAddress (TargetMemoryAccess target)
+		{
+			return address;
+		}
+
+		internal override TargetBlob ReadMemory (TargetMemoryAccess target, int size)
+		{
+			if (offset + size > blob.Size)
+				return target.ReadMemory (address, size);
+
+			byte[] data = new byte [size];
+			Array.Copy (blob.Contents, offset, data, 0, size);
+
+			return new TargetBlob (data, blob.TargetMemoryInfo);
+		}
+
+		internal override void WriteBuffer (TargetMemoryAccess target, byte[] data)
+		{
+			target.WriteBuffer (address, data);
+
+			if (offset + data.Length <= blob.Size)
+				Array.Copy (data, 0, blob.Contents, offset, data.Length);
+		}
+
+		public override string Print ()
+		{
+			return address.ToString ();
+		}
+
+		protected override string MyToString ()
+		{
+			return String.Format (":{0}:{1}", address, offset);
+		}
+	}
+}
@@ -94,6 +94,57 @@ namespace Mono.Debugger.Languages
 
 		internal abstract TargetObject GetElement (TargetMemoryAccess target, int[] indices);
 
+		// <summary>
+		//   Returns @count consecutive elements, starting at @indices and
+		//   running along the last dimension.  This is a lot faster than
+		//   calling GetElement() for each of them since the whole range may
+		//   be read from the target at once.
+		//
+		//   Elements of a fundamental type are a snapshot of the array's
+		//   contents at the time they were read.
+		// </summary>
+		public TargetObject[] GetElements (Thread thread, int[] indices, int count)
+		{
+			return (TargetObject[]) thread.ThreadServant.DoTargetAccess (
+				delegate (TargetMemoryAccess target) {
+					return GetElements (target, indices, count);
+			});
+		}
+
+		internal virtual TargetObject[] GetElements (TargetMemoryAccess target,
+							     int[] indices, int count)
+		{
+			CheckElementRange (target, indices, count);
+
+			TargetObject[] retval = new TargetObject [count];
+			int[] current = (int []) indices.Clone ();
+			for (int i = 0; i < count; i++) {
+				current [Rank - 1] = indices [Rank - 1] + i;
+				retval [i] = GetElement (target, current);
+			}
+
+			return retval;
+		}
+
+		protected void CheckElementRange (TargetMemoryAccess target, int[] indices,
+						  int count)
+		{
+			if (!GetArrayBounds (target))
+				throw new LocationInvalidException ();
+
+			if ((indices.Length != Rank) || (count < 0))
+				throw new ArgumentException ();
+
+			if (count == 0)
+				return;
+
+			int[] last = (int []) indices.Clone ();
+			last [Rank - 1] += count - 1;
+
+			GetArrayOffset (target, indices);
+			GetArrayOffset (target, last);
+		}
+
 		public void SetElement (Thread thread, int[] indices, TargetObject obj)
 		{
 			thread.ThreadServant.DoTargetAccess (
@@ -125,6 +125,19 @@ namespace Mono.Debugger.Languages
 			get { return Setter != null; }
 		}
 
+		// <summary>
+		//   If the getter doesn't do anything but return a field of @instance,
+		//   read that field directly instead of invoking the getter.
+		//
+		//   Returns false if the getter needs to be invoked.
+		// </summary>
+		public virtual bool TryGetValue (Thread thread, TargetStructObject instance,
+						 out TargetObject value)
+		{
+			value = null;
+			return false;
+		}
+
 		protected override string MyToString ()
 		{
 			return String.Format ("{0}:{1}", Getter, Setter);
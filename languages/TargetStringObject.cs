@@ -0,0 +1,44 @@
+using System;
+
+using Mono.Debugger.Backend;
+
+namespace Mono.Debugger.Languages
+{
+	// <summary>
+	//   A string whose contents can be read piece by piece, so we don't need to
+	//   read all of a huge string just to display its beginning.
+	// </summary>
+	public abstract class TargetStringObject : TargetFundamentalObject
+	{
+		internal TargetStringObject (TargetFundamentalType type, TargetLocation location)
+			: base (type, location)
+		{ }
+
+		// <summary>
+		//   The length of the string in characters.
+		// </summary>
+		public int GetLength (Thread thread)
+		{
+			return (int) thread.ThreadServant.DoTargetAccess (
+				delegate (TargetMemoryAccess target) {
+					return GetLength (target);
+			});
+		}
+
+		internal abstract int GetLength (TargetMemoryAccess target);
+
+		// <summary>
+		//   Reads @length characters, starting at character @start.
+		// </summary>
+		public string GetSubstring (Thread thread, int start, int length)
+		{
+			return (string) thread.ThreadServant.DoTargetAccess (
+				delegate (TargetMemoryAccess target) {
+					return GetSubstring (target, start, length);
+			});
+		}
+
+		internal abstract string GetSubstring (TargetMemoryAccess target, int start,
+						       int length);
+	}
+}
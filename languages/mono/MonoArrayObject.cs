@@ -64,6 +64,55 @@ namespace Mono.Debugger.Languages.Mono
 			return Type.ElementType.GetObject (target, new_loc);
 		}
 
+		internal override TargetObject[] GetElements (TargetMemoryAccess target,
+							     int[] indices, int count)
+		{
+			CheckElementRange (target, indices, count);
+
+			int offset = GetArrayOffset (target, indices);
+			int element_size = Type.GetElementSize (target);
+
+			TargetBlob blob;
+			TargetLocation dynamic_location;
+			try {
+				blob = Location.ReadMemory (target, Type.Size);
+				GetDynamicSize (target, blob, Location, out dynamic_location);
+			} catch (TargetException ex) {
+				throw new LocationInvalidException (ex);
+			}
+
+			if (!dynamic_location.HasAddress)
+				return base.GetElements (target, indices, count);
+
+			TargetAddress start = dynamic_location.GetAddress (target) + offset;
+			TargetBlob page = target.ReadMemory (start, count * element_size);
+			TargetBinaryReader reader = page.GetReader ();
+
+			TargetObject[] retval = new TargetObject [count];
+			for (int i = 0; i < count; i++) {
+				int pos = i * element_size;
+
+				if (!Type.ElementType.IsByRef) {
+					TargetLocation loc = new BufferedTargetLocation (
+						start + pos, page, pos);
+					retval [i] = Type.ElementType.GetObject (target, loc);
+					continue;
+				}
+
+				reader.Position = pos;
+				TargetAddress address = new TargetAddress (
+					target.AddressDomain, reader.ReadAddress ());
+
+				if (address.IsNull)
+					retval [i] = new TargetNullObject (Type.ElementType);
+				else
+					retval [i] = Type.ElementType.GetObject (
+						target, new AbsoluteTargetLocation (address));
+			}
+
+			return retval;
+		}
+
 		internal override void SetElement (TargetMemoryAccess target, int[] indices,
 						   TargetObject obj)
 		{
@@ -32,12 +32,14 @@ namespace Mono.Debugger.Languages.Mono
 							   TargetMemoryAccess target,
 							   TargetAddress klass)
 		{
-			TargetAddress image = mono.MetadataHelper.MonoClassGetMonoImage (target, klass);
-			MonoSymbolFile file = mono.GetImage (image);
+			MetadataHelper.MonoClassSnapshot snapshot = mono.MetadataHelper.ReadMonoClass (
+				target, klass);
+
+			MonoSymbolFile file = mono.GetImage (snapshot.Image);
 			if (file == null)
 				throw new InternalError ();
 
-			int token = mono.MetadataHelper.MonoClassGetToken (target, klass);
+			int token = snapshot.Token;
 			if ((token & 0xff000000) != 0x02000000)
 				throw new InternalError ();
 
@@ -97,9 +99,12 @@ namespace Mono.Debugger.Languages.Mono
 			this.KlassAddress = klass;
 			this.CecilType = typedef;
 
-			parent_klass = MetadataHelper.MonoClassGetParent (target, klass);
-			GenericClass = MetadataHelper.MonoClassGetGenericClass (target, klass);
-			GenericContainer = MetadataHelper.MonoClassGetGenericContainer (target, klass);
+			MetadataHelper.MonoClassSnapshot snapshot = MetadataHelper.ReadMonoClass (
+				target, klass);
+
+			parent_klass = snapshot.Parent;
+			GenericClass = snapshot.GenericClass;
+			GenericContainer = snapshot.GenericContainer;
 		}
 
 		protected MetadataHelper MetadataHelper {
@@ -128,8 +133,11 @@ namespace Mono.Debugger.Languages.Mono
 			if (fields != null)
 				return fields;
 
-			int field_count = MetadataHelper.MonoClassGetFieldCount (target, KlassAddress);
-			if ((field_count != 0) && !MetadataHelper.MonoClassHasFields (target, KlassAddress))
+			MetadataHelper.MonoClassSnapshot snapshot = MetadataHelper.ReadMonoClass (
+				target, KlassAddress);
+
+			int field_count = snapshot.FieldCount;
+			if ((field_count != 0) && !snapshot.HasFields)
 				throw new TargetException (TargetError.ClassNotInitialized);
 
 			fields = new MonoFieldInfo [field_count];
@@ -139,12 +147,9 @@ namespace Mono.Debugger.Languages.Mono
 			for (int i = 0; i < field_count; i++) {
 				Cecil.FieldDefinition field = CecilType.Fields [i];
 
-				TargetAddress type_addr = MetadataHelper.MonoClassGetFieldType (
-					target, KlassAddress, i);
-
-				field_types [i] = SymbolFile.MonoLanguage.ReadType (target, type_addr);
-				field_offsets [i] = MetadataHelper.MonoClassGetFieldOffset (
-					target, KlassAddress, i);
+				field_types [i] = SymbolFile.MonoLanguage.ReadType (
+					target, snapshot.FieldTypes [i]);
+				field_offsets [i] = snapshot.FieldOffsets [i];
 
 				fields [i] = new MonoFieldInfo (struct_type, field_types [i], i, field);
 			}
@@ -214,17 +214,7 @@ namespace Mono.Debugger.Languages.Mono
 
 			internal override void MethodLoaded (TargetAccess target, Method method)
 			{
-				TargetAddress address;
-				if (Line != -1) {
-					if (method.HasLineNumbers)
-						address = method.LineNumberTable.Lookup (Line, Column);
-					else
-						address = TargetAddress.Null;
-				} else if (method.HasMethodBounds)
-					address = method.MethodStartAddress;
-				else
-					address = method.StartAddress;
-
+				TargetAddress address = GetMethodAddress (method);
 				if (address.IsNull)
 					return;
 
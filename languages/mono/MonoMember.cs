@@ -2,6 +2,7 @@ using System;
 using System.Text;
 using System.Diagnostics;
 using System.Collections;
+using System.Collections.Generic;
 using Cecil = Mono.Cecil;
 
 using Mono.Debugger.Backend;
@@ -194,6 +195,11 @@ namespace Mono.Debugger.Languages.Mono
 		DebuggerBrowsableState? browsable_state = null;
 		DebuggerDisplayAttribute debugger_display;
 
+		[NonSerialized]
+		Cecil.FieldDefinition backing_field;
+		[NonSerialized]
+		MonoFieldInfo backing_field_info;
+
 		private MonoPropertyInfo (TargetType type, IMonoStructType klass, int index,
 					  bool is_static, Cecil.PropertyDefinition pinfo,
 					  TargetMemberAccessibility accessibility,
@@ -204,6 +210,9 @@ namespace Mono.Debugger.Languages.Mono
 			this.GetterType = getter;
 			this.SetterType = setter;
 
+			if (!is_static)
+				backing_field = GetBackingField (pinfo);
+
 			bool is_compiler_generated;
 			DebuggerTypeProxyAttribute type_proxy;
 			MonoSymbolFile.CheckCustomAttributes (pinfo,
@@ -221,6 +230,99 @@ namespace Mono.Debugger.Languages.Mono
 			get { return debugger_display; }
 		}
 
+		// <summary>
+		//   Checks whether the getter's IL is just `return this.field;', like
+		//   the getter of an auto-implemented property.  We also accept the
+		//   `stloc.0; br; ldloc.0' sequence which mcs and csc emit in debug
+		//   builds.
+		//
+		//   The getter must not be overridable, since TryGetValue() doesn't do
+		//   virtual dispatch, and the field must be declared in the same
+		//   (non-generic) type.
+		// </summary>
+		static Cecil.FieldDefinition GetBackingField (Cecil.PropertyDefinition pinfo)
+		{
+			Cecil.MethodDefinition getter = pinfo.GetMethod;
+			if ((getter == null) || getter.IsStatic || !getter.HasBody ||
+			    (getter.Parameters.Count != 0))
+				return null;
+
+			Cecil.TypeDefinition decl_type = getter.DeclaringType as Cecil.TypeDefinition;
+			if ((decl_type == null) || (decl_type.GenericParameters.Count != 0))
+				return null;
+
+			if (getter.IsVirtual && !getter.IsFinal && !decl_type.IsSealed)
+				return null;
+
+			List<Cecil.Cil.Instruction> insns = new List<Cecil.Cil.Instruction> ();
+			foreach (Cecil.Cil.Instruction insn in getter.Body.Instructions) {
+				if (insn.OpCode.Code != Cecil.Cil.Code.Nop)
+					insns.Add (insn);
+			}
+
+			if ((insns.Count < 3) || (insns [0].OpCode.Code != Cecil.Cil.Code.Ldarg_0) ||
+			    (insns [1].OpCode.Code != Cecil.Cil.Code.Ldfld))
+				return null;
+
+			Cecil.FieldDefinition field = insns [1].Operand as Cecil.FieldDefinition;
+			if ((field == null) || field.IsStatic || (field.DeclaringType != decl_type))
+				return null;
+
+			int pos = 2;
+			if (insns [pos].OpCode.Code == Cecil.Cil.Code.Stloc_0) {
+				pos++;
+				if ((pos < insns.Count) &&
+				    ((insns [pos].OpCode.Code == Cecil.Cil.Code.Br) ||
+				     (insns [pos].OpCode.Code == Cecil.Cil.Code.Br_S)))
+					pos++;
+				if ((pos >= insns.Count) ||
+				    (insns [pos].OpCode.Code != Cecil.Cil.Code.Ldloc_0))
+					return null;
+				pos++;
+			}
+
+			if ((pos != insns.Count - 1) || (insns [pos].OpCode.Code != Cecil.Cil.Code.Ret))
+				return null;
+
+			return field;
+		}
+
+		public override bool TryGetValue (Thread thread, TargetStructObject instance,
+						  out TargetObject value)
+		{
+			value = null;
+			if ((backing_field == null) || (instance == null))
+				return false;
+
+			try {
+				value = (TargetObject) thread.ThreadServant.DoTargetAccess (
+					delegate (TargetMemoryAccess target) {
+						MonoClassInfo info = Klass.ResolveClass (target, false);
+						if (info == null)
+							return null;
+
+						if (backing_field_info == null) {
+							foreach (MonoFieldInfo field in info.GetFields (target)) {
+								if (field.FieldInfo == backing_field) {
+									backing_field_info = field;
+									break;
+								}
+							}
+						}
+
+						if (backing_field_info == null)
+							return null;
+
+						return info.GetInstanceField (
+							target, instance, backing_field_info);
+				});
+			} catch (TargetException) {
+				value = null;
+			}
+
+			return value != null;
+		}
+
 		internal static MonoPropertyInfo Create (IMonoStructType klass, int index,
 							 Cecil.PropertyDefinition pinfo)
 		{
@@ -5,7 +5,7 @@ using Mono.Debugger.Backend.Mono;
 
 namespace Mono.Debugger.Languages.Mono
 {
-	internal class MonoStringObject : TargetFundamentalObject
+	internal class MonoStringObject : TargetStringObject
 	{
 		new protected readonly MonoStringType Type;
 
@@ -25,21 +25,33 @@ namespace Mono.Debugger.Languages.Mono
 			return reader.ReadInteger (4) * 2;
 		}
 
-		protected override object DoGetObject (TargetMemoryAccess target)
+		internal override int GetLength (TargetMemoryAccess target)
 		{
-			TargetLocation dynamic_location;
-			TargetBlob object_blob = Location.ReadMemory (target, type.Size);
-			long size = GetDynamicSize (
-				target, object_blob, Location, out dynamic_location);
+			TargetBlob blob = Location.ReadMemory (target, Type.Size);
+			TargetBinaryReader reader = blob.GetReader ();
+			reader.Position = Type.ObjectSize;
+			return reader.ReadInt32 ();
+		}
 
-			if (size > (long) MonoStringType.MaximumStringLength)
-				size = MonoStringType.MaximumStringLength;
+		internal override string GetSubstring (TargetMemoryAccess target, int start,
+						       int length)
+		{
+			if ((start < 0) || (length < 0) || (start + length > GetLength (target)))
+				throw new ArgumentOutOfRangeException ();
 
-			TargetBlob blob = dynamic_location.ReadMemory (target, (int) size);
+			return ReadChars (target, start, length);
+		}
 
-			TargetBinaryReader reader = blob.GetReader ();
-			int length = (int) reader.Size / 2;
+		string ReadChars (TargetMemoryAccess target, int start, int length)
+		{
+			if (length == 0)
+				return "";
 
+			TargetLocation location = Location.GetLocationAtOffset (
+				Type.ObjectSize + 4 + 2 * start);
+			TargetBlob blob = location.ReadMemory (target, 2 * length);
+
+			TargetBinaryReader reader = blob.GetReader ();
 			char[] retval = new char [length];
 
 			for (int i = 0; i < length; i++)
@@ -48,6 +60,15 @@ namespace Mono.Debugger.Languages.Mono
 			return new String (retval);
 		}
 
+		protected override object DoGetObject (TargetMemoryAccess target)
+		{
+			int length = GetLength (target);
+			if (length > MonoStringType.MaximumStringLength)
+				length = MonoStringType.MaximumStringLength;
+
+			return ReadChars (target, 0, length);
+		}
+
 		internal static string ReadString (MonoLanguageBackend mono, TargetMemoryAccess target,
 						   TargetAddress address)
 		{
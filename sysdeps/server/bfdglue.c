@@ -4,6 +4,10 @@
 #if defined(__linux__) || defined(__FreeBSD__)
 #include <link.h>
 #include <elf.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 #ifdef __linux__
 #include <sys/user.h>
@@ -131,6 +135,15 @@ read_memory_func (bfd_vma memaddr, bfd_byte *myaddr, unsigned int length, struct
 {
 	BfdGlueDisassemblerInfo *data = info->application_data;
 
+	if (data->code) {
+		if ((memaddr < data->code_start) ||
+		    (memaddr + length > data->code_start + data->code_size))
+			return 1;
+
+		memcpy (myaddr, data->code + (memaddr - data->code_start), length);
+		return 0;
+	}
+
 	return (* data->read_memory_cb) (memaddr, myaddr, length);
 }
 
@@ -146,6 +159,13 @@ fprintf_func (gpointer stream, const char *message, ...)
 	output = g_strdup_vprintf (message, args);
 	va_end (args);
 
+	if (data->text) {
+		retval = strlen (output);
+		g_string_append (data->text, output);
+		g_free (output);
+		return retval;
+	}
+
 	data->output_cb (output);
 	retval = strlen (output);
 	g_free (output);
@@ -157,8 +177,22 @@ static void
 print_address_func (bfd_vma address, struct disassemble_info *info)
 {
 	BfdGlueDisassemblerInfo *data = info->application_data;
+	BfdGlueDisassembledInsn *insn = data->current_insn;
+
+	if (!data->text) {
+		(* data->print_address_cb) (address);
+		return;
+	}
 
-	(* data->print_address_cb) (address);
+	if (!insn || insn->target_length) {
+		g_string_append_printf (data->text, "0x%" G_GINT64_MODIFIER "x", (guint64) address);
+		return;
+	}
+
+	insn->target = address;
+	insn->target_offset = data->text->len;
+	g_string_append_printf (data->text, "0x%" G_GINT64_MODIFIER "x", (guint64) address);
+	insn->target_length = data->text->len - insn->target_offset;
 }
 
 BfdGlueDisassemblerInfo *
@@ -207,12 +241,128 @@ bfd_glue_disassemble_insn (BfdGlueDisassemblerInfo *handle, guint64 address)
 	return handle->disassembler (address, handle->info);
 }
 
+/*
+ * Disassemble all the instructions in `code', which has been read from `start',
+ * without calling back into managed code.  All the text goes into one buffer;
+ * addresses are printed in hex and also recorded in the instruction, so the
+ * caller may replace them with symbol names.
+ *
+ * Returns the number of instructions; we stop at the first one we can't decode.
+ * Both `*insns' and `*text' must be freed with g_free().
+ */
+guint32
+bfd_glue_disassemble_range (BfdGlueDisassemblerInfo *handle, guint64 start, const guint8 *code,
+			    guint32 size, BfdGlueDisassembledInsn **insns, gchar **text)
+{
+	BfdGlueDisassembledInsn *retval;
+	guint32 count = 0, offset = 0;
+
+	/* Each instruction is at least one byte long. */
+	retval = g_new0 (BfdGlueDisassembledInsn, size + 1);
+
+	handle->code = code;
+	handle->code_start = start;
+	handle->code_size = size;
+	handle->text = g_string_sized_new (size * 8);
+
+	while (offset < size) {
+		BfdGlueDisassembledInsn *insn = &retval [count];
+		int insn_size;
+
+		insn->offset = offset;
+		insn->text_offset = handle->text->len;
+		handle->current_insn = insn;
+
+		insn_size = handle->disassembler (start + offset, handle->info);
+		if (insn_size <= 0) {
+			g_string_truncate (handle->text, insn->text_offset);
+			memset (insn, 0, sizeof (BfdGlueDisassembledInsn));
+			break;
+		}
+
+		insn->size = insn_size;
+		insn->text_length = handle->text->len - insn->text_offset;
+
+		offset += insn_size;
+		count++;
+	}
+
+	*insns = retval;
+	*text = g_string_free (handle->text, FALSE);
+
+	handle->code = NULL;
+	handle->text = NULL;
+	handle->current_insn = NULL;
+
+	return count;
+}
+
 gboolean
 bfd_glue_get_section_contents (bfd *abfd, asection *section, gpointer data, guint32 size)
 {
 	return bfd_get_section_contents (abfd, section, data, 0, size);
 }
 
+/*
+ * Map the contents of `section' directly from the file, so we don't need to
+ * read (and copy) them again each time.  The contents start at `offset' bytes
+ * into the returned mapping; returns NULL if the section can't be mapped (for
+ * instance when it's in an archive or doesn't have any contents on disk) and
+ * the caller should use bfd_glue_get_section_contents() instead.
+ */
+gpointer
+bfd_glue_map_section_contents (bfd *abfd, asection *section, guint32 *offset, guint32 *map_size)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+	struct stat st;
+	file_ptr start;
+	long page_size;
+	gpointer map;
+	int fd;
+
+	if ((abfd->flags & BFD_IN_MEMORY) || abfd->my_archive)
+		return NULL;
+	if (!(section->flags & SEC_HAS_CONTENTS) || (section->flags & SEC_IN_MEMORY))
+		return NULL;
+	if (!section->_raw_size || (section->filepos <= 0))
+		return NULL;
+
+	page_size = sysconf (_SC_PAGESIZE);
+	start = section->filepos & ~((file_ptr) page_size - 1);
+
+	fd = open (abfd->filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	/* Touching a page beyond the end of the file would give us a SIGBUS. */
+	if ((fstat (fd, &st) < 0) || (section->filepos + section->_raw_size > st.st_size)) {
+		close (fd);
+		return NULL;
+	}
+
+	*offset = section->filepos - start;
+	*map_size = *offset + section->_raw_size;
+
+	map = mmap (NULL, *map_size, PROT_READ, MAP_PRIVATE, fd, start);
+	close (fd);
+
+	if (map == MAP_FAILED)
+		return NULL;
+
+	return map;
+#else
+	return NULL;
+#endif
+}
+
+void
+bfd_glue_unmap_section_contents (gpointer map, guint32 map_size)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+	munmap (map, map_size);
+#endif
+}
+
 asection *
 bfd_glue_get_first_section (bfd *abfd)
 {
@@ -29,12 +29,34 @@ typedef int (*BfdGlueReadMemoryHandler) (guint64 address, bfd_byte *buffer, int
 typedef void (*BfdGlueOutputHandler) (const char *output);
 typedef void (*BfdGluePrintAddressHandler) (guint64 address);
 
+/*
+ * One instruction from bfd_glue_disassemble_range().  `text_offset' and `target_offset'
+ * are offsets into the text buffer; `target' is the first address libopcodes printed
+ * for this instruction, if any.
+ */
+typedef struct {
+	guint64 target;
+	guint32 offset;
+	guint32 size;
+	guint32 text_offset;
+	guint32 text_length;
+	guint32 target_offset;
+	guint32 target_length;
+} BfdGlueDisassembledInsn;
+
 typedef struct {
 	struct disassemble_info *info;
 	BfdGlueReadMemoryHandler read_memory_cb;
 	BfdGlueOutputHandler output_cb;
 	BfdGluePrintAddressHandler print_address_cb;
 	disassembler_ftype disassembler;
+
+	/* Only used while we're in bfd_glue_disassemble_range(). */
+	const guint8 *code;
+	guint64 code_start;
+	guint32 code_size;
+	GString *text;
+	BfdGlueDisassembledInsn *current_insn;
 } BfdGlueDisassemblerInfo;
 
 extern BfdGlueDisassemblerInfo *
@@ -49,6 +71,10 @@ bfd_glue_free_disassembler (BfdGlueDisassemblerInfo *handle);
 extern int
 bfd_glue_disassemble_insn (BfdGlueDisassemblerInfo *handle, guint64 address);
 
+extern guint32
+bfd_glue_disassemble_range (BfdGlueDisassemblerInfo *handle, guint64 start, const guint8 *code,
+			    guint32 size, BfdGlueDisassembledInsn **insns, gchar **text);
+
 typedef enum {
 	SECTION_FLAGS_LOAD	= 1,
 	SECTION_FLAGS_ALLOC	= 2,
@@ -64,6 +90,12 @@ bfd_glue_get_errormsg (void);
 extern gboolean
 bfd_glue_get_section_contents (bfd *abfd, asection *section, gpointer data, guint32 size);
 
+extern gpointer
+bfd_glue_map_section_contents (bfd *abfd, asection *section, guint32 *offset, guint32 *map_size);
+
+extern void
+bfd_glue_unmap_section_contents (gpointer map, guint32 map_size);
+
 extern guint64
 bfd_glue_get_section_vma (asection *p);
 
@@ -22,6 +22,7 @@ mono_debugger_breakpoint_manager_new (void)
 	bpm->breakpoints = g_ptr_array_new ();
 	bpm->breakpoint_hash = g_hash_table_new (NULL, NULL);
 	bpm->breakpoint_by_addr = g_hash_table_new (NULL, NULL);
+	bpm->sorted_breakpoints = g_ptr_array_new ();
 
 	return bpm;
 }
@@ -48,6 +49,7 @@ mono_debugger_breakpoint_manager_free (BreakpointManager *bpm)
 	g_ptr_array_free (bpm->breakpoints, TRUE);
 	g_hash_table_destroy (bpm->breakpoint_hash);
 	g_hash_table_destroy (bpm->breakpoint_by_addr);
+	g_ptr_array_free (bpm->sorted_breakpoints, TRUE);
 	g_free (bpm);
 }
 
@@ -63,10 +65,63 @@ mono_debugger_breakpoint_manager_unlock (void)
 	g_static_rec_mutex_unlock (&bpm_mutex);
 }
 
+/*
+ * Returns the index of the first entry in `sorted_breakpoints' whose address is
+ * greater than or equal to `address'.
+ */
+guint32
+mono_debugger_breakpoint_manager_lower_bound (BreakpointManager *bpm, guint64 address)
+{
+	GPtrArray *sorted = bpm->sorted_breakpoints;
+	guint32 low = 0, high = sorted->len;
+
+	while (low < high) {
+		guint32 mid = low + (high - low) / 2;
+		BreakpointInfo *info = g_ptr_array_index (sorted, mid);
+
+		if (info->address < address)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static void
+sorted_breakpoints_insert (BreakpointManager *bpm, BreakpointInfo *breakpoint)
+{
+	GPtrArray *sorted = bpm->sorted_breakpoints;
+	guint32 pos;
+
+	pos = mono_debugger_breakpoint_manager_lower_bound (bpm, breakpoint->address + 1);
+	g_ptr_array_add (sorted, NULL);
+	if (pos < sorted->len - 1)
+		memmove (sorted->pdata + pos + 1, sorted->pdata + pos,
+			 (sorted->len - pos - 1) * sizeof (gpointer));
+	sorted->pdata [pos] = breakpoint;
+}
+
+static void
+sorted_breakpoints_remove (BreakpointManager *bpm, BreakpointInfo *breakpoint)
+{
+	GPtrArray *sorted = bpm->sorted_breakpoints;
+	guint32 pos;
+
+	pos = mono_debugger_breakpoint_manager_lower_bound (bpm, breakpoint->address);
+	for (; pos < sorted->len; pos++) {
+		if (g_ptr_array_index (sorted, pos) == breakpoint) {
+			g_ptr_array_remove_index (sorted, pos);
+			return;
+		}
+	}
+}
+
 void
 mono_debugger_breakpoint_manager_insert (BreakpointManager *bpm, BreakpointInfo *breakpoint)
 {
 	g_ptr_array_add (bpm->breakpoints, breakpoint);
+	sorted_breakpoints_insert (bpm, breakpoint);
 	g_hash_table_insert (bpm->breakpoint_hash, GSIZE_TO_POINTER (breakpoint->id), breakpoint);
 	g_hash_table_insert (bpm->breakpoint_by_addr, GSIZE_TO_POINTER (breakpoint->address), breakpoint);
 }
@@ -89,6 +144,17 @@ mono_debugger_breakpoint_manager_get_breakpoints (BreakpointManager *bpm)
 	return bpm->breakpoints;
 }
 
+/*
+ * Like mono_debugger_breakpoint_manager_get_breakpoints(), but the breakpoints are
+ * sorted by address.  Use mono_debugger_breakpoint_manager_lower_bound() to find the
+ * first breakpoint inside an address range.
+ */
+GPtrArray *
+mono_debugger_breakpoint_manager_get_sorted_breakpoints (BreakpointManager *bpm)
+{
+	return bpm->sorted_breakpoints;
+}
+
 void
 mono_debugger_breakpoint_manager_remove (BreakpointManager *bpm, BreakpointInfo *breakpoint)
 {
@@ -103,9 +169,29 @@ mono_debugger_breakpoint_manager_remove (BreakpointManager *bpm, BreakpointInfo
 	g_hash_table_remove (bpm->breakpoint_hash, GSIZE_TO_POINTER (breakpoint->id));
 	g_hash_table_remove (bpm->breakpoint_by_addr, GSIZE_TO_POINTER (breakpoint->address));
 	g_ptr_array_remove_fast (bpm->breakpoints, breakpoint);
+	sorted_breakpoints_remove (bpm, breakpoint);
 	g_free (breakpoint);
 }
 
+/*
+ * Read the hit counters of the `count' breakpoints in `ids' in one go; the counters of
+ * breakpoints which don't exist anymore are 0.
+ */
+void
+mono_debugger_breakpoint_manager_get_hit_counts (BreakpointManager *bpm, guint32 count,
+						 const guint32 *ids, guint64 *hit_counts)
+{
+	int i;
+
+	mono_debugger_breakpoint_manager_lock ();
+	for (i = 0; i < count; i++) {
+		BreakpointInfo *info = mono_debugger_breakpoint_manager_lookup_by_id (bpm, ids [i]);
+
+		hit_counts [i] = info ? info->hit_count : 0;
+	}
+	mono_debugger_breakpoint_manager_unlock ();
+}
+
 int
 mono_debugger_breakpoint_manager_get_next_id (void)
 {
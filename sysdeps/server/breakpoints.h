@@ -9,6 +9,7 @@ typedef struct {
 	GPtrArray *breakpoints;
 	GHashTable *breakpoint_hash;
 	GHashTable *breakpoint_by_addr;
+	GPtrArray *sorted_breakpoints;
 } BreakpointManager;
 
 typedef enum {
@@ -18,6 +19,69 @@ typedef enum {
 	HARDWARE_BREAKPOINT_WRITE
 } HardwareBreakpointType;
 
+/*
+ * Simple breakpoint conditions which are evaluated by the server right after the target
+ * stopped; if the condition is false, the server steps over the breakpoint and resumes
+ * the target without reporting anything.
+ */
+typedef enum {
+	BREAKPOINT_CONDITION_NONE = 0,
+	BREAKPOINT_CONDITION_REGISTER,
+	BREAKPOINT_CONDITION_MEMORY
+} BreakpointConditionType;
+
+/*
+ * All comparisons are signed; memory operands are sign-extended to 64 bits.
+ */
+typedef enum {
+	BREAKPOINT_CONDITION_EQ = 0,
+	BREAKPOINT_CONDITION_NE,
+	BREAKPOINT_CONDITION_LT,
+	BREAKPOINT_CONDITION_LE,
+	BREAKPOINT_CONDITION_GT,
+	BREAKPOINT_CONDITION_GE
+} BreakpointConditionOp;
+
+#define BREAKPOINT_CONDITION_MAX_INSN_SIZE	16
+
+typedef struct {
+	/* BreakpointConditionType / BreakpointConditionOp */
+	guint32 type;
+	guint32 op;
+
+	/*
+	 * For BREAKPOINT_CONDITION_REGISTER, the register to compare against `value'.
+	 * For BREAKPOINT_CONDITION_MEMORY, the operand is the `size' bytes at `offset' plus
+	 * the contents of this register - or just at `offset' if it's -1.
+	 */
+	gint32 reg;
+	guint32 size;
+	gint64 offset;
+	gint64 value;
+
+	/* Only break in this thread (LWP); 0 means all threads. */
+	guint32 thread;
+
+	/* Number of times the condition must be true before we actually stop. */
+	guint32 ignore_count;
+
+	/*
+	 * Counting probes never stop the target, they just count the hits; sampling
+	 * breakpoints only stop on every `sample_interval'th hit.  Use
+	 * mono_debugger_breakpoint_manager_get_hit_counts() to read the counters.
+	 */
+	guint32 count_only;
+	guint32 sample_interval;
+
+	/*
+	 * The original instruction at the breakpoint's address; the server executes it out of
+	 * line when skipping the breakpoint.  If `insn_size' is 0, we can't do that and just
+	 * report the hit, flagging it as not matching the condition.
+	 */
+	guint32 insn_size;
+	guint8 insn [BREAKPOINT_CONDITION_MAX_INSN_SIZE];
+} BreakpointCondition;
+
 typedef struct {
 	HardwareBreakpointType type;
 	int id;
@@ -28,6 +92,11 @@ typedef struct {
 	char saved_insn;
 	int runtime_table_slot;
 	guint64 address;
+	gboolean has_condition;
+	BreakpointCondition condition;
+	guint64 hit_count;
+	/* Hits since the condition's ignore count ran out; for sampling breakpoints. */
+	guint64 sample_count;
 } BreakpointInfo;
 
 BreakpointManager *
@@ -60,9 +129,19 @@ mono_debugger_breakpoint_manager_lookup_by_id        (BreakpointManager *bpm, gu
 GPtrArray *
 mono_debugger_breakpoint_manager_get_breakpoints     (BreakpointManager *bpm);
 
+GPtrArray *
+mono_debugger_breakpoint_manager_get_sorted_breakpoints (BreakpointManager *bpm);
+
+guint32
+mono_debugger_breakpoint_manager_lower_bound         (BreakpointManager *bpm, guint64 address);
+
 void
 mono_debugger_breakpoint_manager_remove              (BreakpointManager *bpm, BreakpointInfo *breakpoint);
 
+void
+mono_debugger_breakpoint_manager_get_hit_counts      (BreakpointManager *bpm, guint32 count,
+						      const guint32 *ids, guint64 *hit_counts);
+
 int
 mono_debugger_breakpoint_info_get_id                 (BreakpointInfo *info);
 
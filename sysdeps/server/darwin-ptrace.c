@@ -832,6 +832,27 @@ server_ptrace_get_threads (ServerHandle *handle, guint32 *out_count, guint32 **o
 	return COMMAND_ERROR_NONE;
 }
 
+static ServerCommandError
+server_ptrace_get_thread_count (ServerHandle *handle, guint32 *out_count)
+{
+	InferiorHandle *inferior = handle->inferior;
+	thread_array_t threads;
+	mach_msg_type_number_t count;
+	kern_return_t err;
+
+	err = task_threads(inferior->os.task, &threads, &count);
+	if (err)
+		return COMMAND_ERROR_UNKNOWN_ERROR;
+
+	*out_count = count;
+
+	err = vm_deallocate (mach_task_self(), (vm_address_t) threads, (count * sizeof (int)));
+	if (err)
+		g_message (G_STRLOC ": vm_deallocate failed: %d", err);
+
+	return COMMAND_ERROR_NONE;
+}
+
 static ServerCommandError
 server_ptrace_get_application (ServerHandle *handle, gchar **exe_file, gchar **cwd,
 			       guint32 *nargs, gchar ***cmdline_args)
@@ -92,15 +92,16 @@ x86_arch_remove_breakpoints_from_target_memory (ServerHandle *handle, guint64 st
 
 	mono_debugger_breakpoint_manager_lock ();
 
-	breakpoints = mono_debugger_breakpoint_manager_get_breakpoints (handle->bpm);
-	for (i = 0; i < breakpoints->len; i++) {
+	breakpoints = mono_debugger_breakpoint_manager_get_sorted_breakpoints (handle->bpm);
+	i = mono_debugger_breakpoint_manager_lower_bound (handle->bpm, start);
+	for (; i < breakpoints->len; i++) {
 		BreakpointInfo *info = g_ptr_array_index (breakpoints, i);
 		guint32 offset;
 
+		if (info->address >= start+size)
+			break;
 		if (info->is_hardware_bpt || !info->enabled)
 			continue;
-		if ((info->address < start) || (info->address >= start+size))
-			continue;
 
 		offset = (guint32) info->address - start;
 		ptr [offset] = info->saved_insn;
@@ -544,6 +545,63 @@ x86_arch_get_registers (ServerHandle *handle)
 	return COMMAND_ERROR_NONE;
 }
 
+/*
+ * Called by server_ptrace_step_range() each time the target stopped; check whether
+ * we may single-step the next instruction without reporting back.
+ */
+static gboolean
+x86_arch_step_range_continue (ServerHandle *handle, guint64 start, guint64 end)
+{
+	INFERIOR_REGS_TYPE regs;
+	guint64 pc;
+	guint8 code [16];
+	int i;
+
+	/*
+	 * We would have to check the debug status register after each step; let
+	 * x86_arch_child_stopped() deal with hardware breakpoints and watchpoints.
+	 */
+	if (handle->arch->dr_control || handle->arch->code_buffer)
+		return FALSE;
+
+	if (_server_ptrace_get_registers (handle->inferior, &regs) != COMMAND_ERROR_NONE)
+		return FALSE;
+
+	pc = INFERIOR_REG_EIP (regs);
+	if ((pc < start) || (pc >= end))
+		return FALSE;
+
+	if (_server_ptrace_read_memory (handle, pc, sizeof (code), code) != COMMAND_ERROR_NONE)
+		return FALSE;
+
+	/*
+	 * Skip all instruction prefixes.
+	 */
+	for (i = 0; i < sizeof (code) - 2; i++) {
+		guint8 byte = code [i];
+
+		if ((byte == 0x26) || (byte == 0x2e) || (byte == 0x36) || (byte == 0x3e) ||
+		    (byte == 0x64) || (byte == 0x65) || (byte == 0x66) || (byte == 0x67) ||
+		    (byte == 0xf0) || (byte == 0xf2) || (byte == 0xf3))
+			continue;
+		break;
+	}
+
+	switch (code [i]) {
+	case 0xcc: /* int3 - breakpoint or notification */
+	case 0xe8: /* call rel32 */
+	case 0x9a: /* lcall ptr16:32 */
+		return FALSE;
+
+	case 0xff: /* call / lcall r/m */
+		if ((((code [i+1] >> 3) & 7) == 2) || (((code [i+1] >> 3) & 7) == 3))
+			return FALSE;
+		break;
+	}
+
+	return TRUE;
+}
+
 ChildStoppedAction
 x86_arch_child_stopped (ServerHandle *handle, int stopsig,
 			guint64 *callback_arg, guint64 *retval, guint64 *retval2,
@@ -596,6 +654,8 @@ x86_arch_child_stopped (ServerHandle *handle, int stopsig,
 	if (check_breakpoint (handle, (guint32) INFERIOR_REG_EIP (arch->current_regs) - 1, retval)) {
 		INFERIOR_REG_EIP (arch->current_regs)--;
 		_server_ptrace_set_registers (inferior, &arch->current_regs);
+		if (!_server_ptrace_check_breakpoint_condition (handle, (guint32) *retval))
+			return STOP_ACTION_BREAKPOINT_IGNORED;
 		return STOP_ACTION_BREAKPOINT_HIT;
 	}
 
@@ -670,7 +730,7 @@ x86_arch_child_stopped (ServerHandle *handle, int stopsig,
 
 	cbuffer = arch->code_buffer;
 	if (cbuffer) {
-		handle->mono_runtime->executable_code_bitfield [cbuffer->slot] = 0;
+		runtime_slot_table_free (&handle->mono_runtime->executable_code_slots, cbuffer->slot);
 
 		if (cbuffer->code_address + cbuffer->insn_size != INFERIOR_REG_EIP (arch->current_regs)) {
 			g_warning (G_STRLOC ": %x - %x,%d - %x - %x", cbuffer->original_eip,
@@ -823,22 +883,6 @@ server_ptrace_get_registers_from_core_file (guint64 *values, const guint8 *buffe
 	values [DEBUGGER_REG_SS] = (guint32) INFERIOR_REG_SS (regs);
 }
 
-static int
-find_breakpoint_table_slot (MonoRuntimeInfo *runtime)
-{
-	int i;
-
-	for (i = 1; i < runtime->breakpoint_table_size; i++) {
-		if (runtime->breakpoint_table_bitfield [i])
-			continue;
-
-		runtime->breakpoint_table_bitfield [i] = 1;
-		return i;
-	}
-
-	return -1;
-}
-
 static ServerCommandError
 runtime_info_enable_breakpoint (ServerHandle *handle, BreakpointInfo *breakpoint)
 {
@@ -850,9 +894,12 @@ runtime_info_enable_breakpoint (ServerHandle *handle, BreakpointInfo *breakpoint
 	runtime = handle->mono_runtime;
 	g_assert (runtime);
 
-	slot = find_breakpoint_table_slot (runtime);
-	if (slot < 0)
+	slot = runtime_slot_table_alloc (&runtime->breakpoint_table_slots);
+	if (slot < 0) {
+		g_warning (G_STRLOC ": Runtime breakpoint table is full (%u slots).",
+			   runtime->breakpoint_table_slots.size);
 		return COMMAND_ERROR_INTERNAL_ERROR;
+	}
 
 	breakpoint->runtime_table_slot = slot;
 
@@ -861,17 +908,22 @@ runtime_info_enable_breakpoint (ServerHandle *handle, BreakpointInfo *breakpoint
 
 	result = server_ptrace_poke_word (handle, table_address, breakpoint->address);
 	if (result != COMMAND_ERROR_NONE)
-		return result;
+		goto error;
 
 	result = server_ptrace_poke_word (handle, table_address + 4, (gsize) breakpoint->saved_insn);
 	if (result != COMMAND_ERROR_NONE)
-		return result;
+		goto error;
 
 	result = server_ptrace_poke_word (handle, index_address, (gsize) slot);
 	if (result != COMMAND_ERROR_NONE)
-		return result;
+		goto error;
 
 	return COMMAND_ERROR_NONE;
+
+ error:
+	runtime_slot_table_free (&runtime->breakpoint_table_slots, slot);
+	breakpoint->runtime_table_slot = 0;
+	return result;
 }
 
 static ServerCommandError
@@ -886,13 +938,17 @@ runtime_info_disable_breakpoint (ServerHandle *handle, BreakpointInfo *breakpoin
 	g_assert (runtime);
 
 	slot = breakpoint->runtime_table_slot;
-	index_address = runtime->breakpoint_table + runtime->address_size * slot;
+	if (!slot)
+		return COMMAND_ERROR_NONE;
+
+	index_address = runtime->breakpoint_table + 4 * slot;
 
 	result = server_ptrace_poke_word (handle, index_address, 0);
 	if (result != COMMAND_ERROR_NONE)
 		return result;
 
-	runtime->breakpoint_table_bitfield [slot] = 0;
+	runtime_slot_table_free (&runtime->breakpoint_table_slots, slot);
+	breakpoint->runtime_table_slot = 0;
 
 	return COMMAND_ERROR_NONE;
 }
@@ -1188,33 +1244,6 @@ server_ptrace_get_breakpoints (ServerHandle *handle, guint32 *count, guint32 **r
 	return COMMAND_ERROR_NONE;	
 }
 
-static int
-find_code_buffer_slot (MonoRuntimeInfo *runtime)
-{
-	int i;
-
-	for (i = runtime->executable_code_last_slot + 1; i < runtime->executable_code_total_chunks; i++) {
-		if (runtime->executable_code_bitfield [i])
-			continue;
-
-		runtime->executable_code_bitfield [i] = 1;
-		runtime->executable_code_last_slot = i;
-		return i;
-	}
-
-	runtime->executable_code_last_slot = 0;
-	for (i = 0; i < runtime->executable_code_total_chunks; i++) {
-		if (runtime->executable_code_bitfield [i])
-			continue;
-
-		runtime->executable_code_bitfield [i] = 1;
-		runtime->executable_code_last_slot = i;
-		return i;
-	}
-
-	return -1;
-}
-
 static ServerCommandError
 server_ptrace_execute_instruction (ServerHandle *handle, const guint8 *instruction,
 				   guint32 size, gboolean update_ip)
@@ -1231,15 +1260,15 @@ server_ptrace_execute_instruction (ServerHandle *handle, const guint8 *instructi
 	if (!runtime->executable_code_buffer)
 		return COMMAND_ERROR_INTERNAL_ERROR;
 
-	slot = find_code_buffer_slot (runtime);
-	if (slot < 0)
-		return COMMAND_ERROR_INTERNAL_ERROR;
-
 	if (size > runtime->executable_code_chunk_size)
 		return COMMAND_ERROR_INTERNAL_ERROR;
 	if (handle->arch->code_buffer)
 		return COMMAND_ERROR_INTERNAL_ERROR;
 
+	slot = runtime_slot_table_alloc (&runtime->executable_code_slots);
+	if (slot < 0)
+		return COMMAND_ERROR_INTERNAL_ERROR;
+
 	code_address = runtime->executable_code_buffer + slot * runtime->executable_code_chunk_size;
 
 	data = g_new0 (CodeBufferData, 1);
@@ -1265,6 +1294,14 @@ server_ptrace_execute_instruction (ServerHandle *handle, const guint8 *instructi
 	return server_ptrace_step (handle);
 }
 
+static ServerCommandError
+server_ptrace_execute_displaced_instruction (ServerHandle *handle, const guint8 *instruction,
+					     guint32 size, guint32 disp_offset)
+{
+	/* There's no IP-relative addressing on the i386. */
+	return COMMAND_ERROR_NOT_IMPLEMENTED;
+}
+
 static ServerCommandError
 server_ptrace_mark_rti_frame (ServerHandle *handle)
 {
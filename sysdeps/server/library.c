@@ -114,6 +114,15 @@ mono_debugger_server_global_wait (guint32 *status)
 	return (* global_vtable->global_wait) (status);
 }
 
+guint32
+mono_debugger_server_global_poll (guint32 *status)
+{
+	if (!global_vtable->global_poll)
+		return 0;
+
+	return (* global_vtable->global_poll) (status);
+}
+
 ServerStatusMessageType
 mono_debugger_server_dispatch_event (ServerHandle *handle, guint32 status, guint64 *arg,
 				     guint64 *data1, guint64 *data2, guint32 *opt_data_size,
@@ -167,6 +176,15 @@ mono_debugger_server_step (ServerHandle *handle)
 	return (* global_vtable->step) (handle);
 }
 
+ServerCommandError
+mono_debugger_server_step_range (ServerHandle *handle, guint64 start, guint64 end)
+{
+	if (!global_vtable->step_range)
+		return mono_debugger_server_step (handle);
+
+	return (* global_vtable->step_range) (handle, start, end);
+}
+
 ServerCommandError
 mono_debugger_server_continue (ServerHandle *handle)
 {
@@ -221,6 +239,32 @@ mono_debugger_server_write_memory (ServerHandle *handle, guint64 start, guint32
 	return (* global_vtable->write_memory) (handle, start, size, data);
 }
 
+ServerCommandError
+mono_debugger_server_read_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+					 const guint32 *sizes, gpointer data)
+{
+	guint8 *ptr = data;
+	int i;
+
+	if (global_vtable->read_memory_vector)
+		return (* global_vtable->read_memory_vector) (handle, count, addresses, sizes, data);
+
+	if (!global_vtable->read_memory)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	for (i = 0; i < count; i++) {
+		ServerCommandError result;
+
+		result = (* global_vtable->read_memory) (handle, addresses [i], sizes [i], ptr);
+		if (result != COMMAND_ERROR_NONE)
+			return result;
+
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
+}
+
 ServerCommandError
 mono_debugger_server_call_method (ServerHandle *handle, guint64 method_address,
 				  guint64 method_argument1, guint64 method_argument2,
@@ -300,6 +344,17 @@ mono_debugger_server_execute_instruction (ServerHandle *handle, const guint8 *in
 		handle, instruction, insn_size, update_ip);
 }
 
+ServerCommandError
+mono_debugger_server_execute_displaced_instruction (ServerHandle *handle, const guint8 *instruction,
+						    guint32 insn_size, guint32 disp_offset)
+{
+	if (!global_vtable->execute_displaced_instruction)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	return (* global_vtable->execute_displaced_instruction) (
+		handle, instruction, insn_size, disp_offset);
+}
+
 ServerCommandError
 mono_debugger_server_mark_rti_frame (ServerHandle *handle)
 {
@@ -347,6 +402,49 @@ mono_debugger_server_remove_breakpoint (ServerHandle *handle, guint32 breakpoint
 	return (* global_vtable->remove_breakpoint) (handle, breakpoint);
 }
 
+ServerCommandError
+mono_debugger_server_insert_breakpoints (ServerHandle *handle, guint32 count, const guint64 *addresses,
+					 guint32 *breakpoints)
+{
+	int i;
+
+	if (global_vtable->insert_breakpoints)
+		return (* global_vtable->insert_breakpoints) (handle, count, addresses, breakpoints);
+
+	if (!global_vtable->insert_breakpoint)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	for (i = 0; i < count; i++) {
+		if ((* global_vtable->insert_breakpoint) (handle, addresses [i], &breakpoints [i]) != COMMAND_ERROR_NONE)
+			breakpoints [i] = 0;
+	}
+
+	return COMMAND_ERROR_NONE;
+}
+
+ServerCommandError
+mono_debugger_server_remove_breakpoints (ServerHandle *handle, guint32 count, const guint32 *breakpoints)
+{
+	ServerCommandError result = COMMAND_ERROR_NONE;
+	int i;
+
+	if (global_vtable->remove_breakpoints)
+		return (* global_vtable->remove_breakpoints) (handle, count, breakpoints);
+
+	if (!global_vtable->remove_breakpoint)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	for (i = 0; i < count; i++) {
+		ServerCommandError ret;
+
+		ret = (* global_vtable->remove_breakpoint) (handle, breakpoints [i]);
+		if ((ret != COMMAND_ERROR_NONE) && (result == COMMAND_ERROR_NONE))
+			result = ret;
+	}
+
+	return result;
+}
+
 ServerCommandError
 mono_debugger_server_enable_breakpoint (ServerHandle *handle, guint32 breakpoint)
 {
@@ -365,6 +463,16 @@ mono_debugger_server_disable_breakpoint (ServerHandle *handle, guint32 breakpoin
 	return (* global_vtable->disable_breakpoint) (handle, breakpoint);
 }
 
+ServerCommandError
+mono_debugger_server_set_breakpoint_condition (ServerHandle *handle, guint32 breakpoint,
+					       BreakpointCondition *condition)
+{
+	if (!global_vtable->set_breakpoint_condition)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	return (* global_vtable->set_breakpoint_condition) (handle, breakpoint, condition);
+}
+
 ServerCommandError
 mono_debugger_server_get_registers (ServerHandle *handle, guint64 *values)
 {
@@ -374,6 +482,43 @@ mono_debugger_server_get_registers (ServerHandle *handle, guint64 *values)
 	return (* global_vtable->get_registers) (handle, values);
 }
 
+/*
+ * Fetch the registers of `count' stopped threads with one call from managed code.
+ *
+ * The registers of the i-th thread go to `values + i * num_registers' and its
+ * result code to `results [i]', so a thread which isn't stopped doesn't fail the
+ * whole call.  If `stack_size' is non-zero, we also copy that many bytes from each
+ * thread's stack pointer to `stack + i * stack_size'; if they can't be read, that
+ * part of the buffer is cleared.
+ */
+void
+mono_debugger_server_get_registers_multiple (guint32 count, ServerHandle **handles,
+					     guint32 num_registers, guint64 *values,
+					     guint32 stack_size, guint8 *stack, guint32 *results)
+{
+	int i;
+
+	if (global_vtable->get_registers_multiple) {
+		(* global_vtable->get_registers_multiple) (
+			count, handles, num_registers, values, stack_size, stack, results);
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		StackFrame frame;
+
+		results [i] = mono_debugger_server_get_registers (
+			handles [i], values + i * num_registers);
+		if ((results [i] != COMMAND_ERROR_NONE) || !stack_size)
+			continue;
+
+		if ((mono_debugger_server_get_frame (handles [i], &frame) != COMMAND_ERROR_NONE) ||
+		    (mono_debugger_server_read_memory (handles [i], frame.stack_pointer, stack_size,
+						       stack + i * stack_size) != COMMAND_ERROR_NONE))
+			memset (stack + i * stack_size, 0, stack_size);
+	}
+}
+
 ServerCommandError
 mono_debugger_server_set_registers (ServerHandle *handle, guint64 *values)
 {
@@ -401,6 +546,23 @@ mono_debugger_server_stop_and_wait (ServerHandle *handle, guint32 *status)
 	return (* global_vtable->stop_and_wait) (handle, status);
 }
 
+void
+mono_debugger_server_stop_all (ServerHandle **handles, guint32 count, guint32 *statuses,
+			       ServerCommandError *results)
+{
+	guint32 i;
+
+	if (global_vtable->stop_all) {
+		(* global_vtable->stop_all) (handles, count, statuses, results);
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		statuses [i] = 0;
+		results [i] = mono_debugger_server_stop_and_wait (handles [i], &statuses [i]);
+	}
+}
+
 ServerCommandError
 mono_debugger_server_set_signal (ServerHandle *handle, guint32 sig, guint32 send_it)
 {
@@ -453,6 +615,15 @@ mono_debugger_server_get_threads (ServerHandle *handle, guint32 *count, guint32
 	return (* global_vtable->get_threads) (handle, count, threads);
 }
 
+ServerCommandError
+mono_debugger_server_get_thread_count (ServerHandle *handle, guint32 *count)
+{
+	if (!global_vtable->get_thread_count)
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+
+	return (* global_vtable->get_thread_count) (handle, count);
+}
+
 ServerCommandError
 mono_debugger_server_get_application (ServerHandle *handle, gchar **exe_file, gchar **cwd,
 				      guint32 *nargs, gchar ***cmdline_args)
@@ -36,7 +36,8 @@ typedef enum {
 	COMMAND_ERROR_NOT_IMPLEMENTED,
 	COMMAND_ERROR_IO_ERROR,
 	COMMAND_ERROR_NO_CALLBACK_FRAME,
-	COMMAND_ERROR_PERMISSION_DENIED
+	COMMAND_ERROR_PERMISSION_DENIED,
+	COMMAND_ERROR_DISPLACEMENT_OUT_OF_RANGE
 } ServerCommandError;
 
 typedef enum {
@@ -56,7 +57,8 @@ typedef enum {
 	MESSAGE_CHILD_NOTIFICATION,
 	MESSAGE_CHILD_INTERRUPTED,
 	MESSAGE_RUNTIME_INVOKE_DONE,
-	MESSAGE_INTERNAL_ERROR
+	MESSAGE_INTERNAL_ERROR,
+	MESSAGE_CHILD_RESUMED
 } ServerStatusMessageType;
 
 typedef struct {
@@ -81,6 +83,20 @@ typedef struct {
 
 #define EXECUTABLE_CODE_CHUNK_SIZE		16
 
+/*
+ * Word-packed bitmap which keeps track of the used slots in the runtime's
+ * breakpoint table and executable code buffer.  `hint' is the word we last
+ * allocated from, so we don't need to rescan the full words before it.
+ */
+typedef struct
+{
+	guint32 size;
+	guint32 reserved;
+	guint32 used;
+	guint32 hint;
+	gulong *bits;
+} RuntimeSlotTable;
+
 typedef struct
 {
 	guint32 address_size;
@@ -94,9 +110,8 @@ typedef struct
 	guint32 breakpoint_table_size;
 
 	/* Private */
-	guint8 *breakpoint_table_bitfield;
-	guint8 *executable_code_bitfield;
-	guint32 executable_code_last_slot;
+	RuntimeSlotTable breakpoint_table_slots;
+	RuntimeSlotTable executable_code_slots;
 } MonoRuntimeInfo;
 
 typedef enum {
@@ -197,9 +212,26 @@ struct InferiorVTable {
 
 	guint32               (* global_wait)         (guint32             *status_ret);
 
+	/*
+	 * Like global_wait(), but returns 0 immediately if no event is ready.
+	 * This is called from the engine thread while the wait thread is idle, to
+	 * process all the events which are ready in one go.
+	 */
+	guint32               (* global_poll)         (guint32             *status_ret);
+
 	ServerCommandError    (* stop_and_wait)       (ServerHandle        *handle,
 						       guint32             *status);
 
+	/*
+	 * Stop all of `handles' and wait until all of them stopped.  This is the
+	 * same as calling stop_and_wait() on each of them, but all the threads are
+	 * signalled before we start waiting.
+	 */
+	void                  (* stop_all)            (ServerHandle       **handles,
+						       guint32              count,
+						       guint32             *statuses,
+						       ServerCommandError  *results);
+
 	ServerStatusMessageType (* dispatch_event)    (ServerHandle        *handle,
 						       guint32              status,
 						       guint64             *arg,
@@ -231,6 +263,15 @@ struct InferiorVTable {
 	 */
 	ServerCommandError    (* step)                (ServerHandle     *handle);
 
+	/*
+	 * Single-step until the instruction pointer leaves the [start, end) range or
+	 * we're about to execute a call instruction or a breakpoint.
+	 * Only the final stop is reported through global_wait().
+	 */
+	ServerCommandError    (* step_range)          (ServerHandle     *handle,
+						       guint64           start,
+						       guint64           end);
+
 	ServerCommandError    (* resume)              (ServerHandle     *handle);
 
 	/*
@@ -268,6 +309,17 @@ struct InferiorVTable {
 						       guint32           size,
 						       gconstpointer     data);
 
+	/*
+	 * Read `count' memory regions in one go; region `i' starts at `addresses [i]' and is
+	 * `sizes [i]' bytes long.  The regions are stored back-to-back into `buffer' (which has
+	 * been allocated by the caller and must be large enough to hold all of them).
+	 */
+	ServerCommandError    (* read_memory_vector)  (ServerHandle     *handle,
+						       guint32           count,
+						       const guint64    *addresses,
+						       const guint32    *sizes,
+						       gpointer          buffer);
+
 	/*
 	 * Call `guint64 (*func) (guint64)' function at address `method' in the target address
 	 * space, pass it argument `method_argument', send a MESSAGE_CHILD_CALLBACK with the
@@ -325,6 +377,18 @@ struct InferiorVTable {
 						       guint32           size,
 						       gboolean          update_ip);
 
+	/*
+	 * Like `execute_instruction', but `instruction' is an IP-relative instruction
+	 * which has been copied from the current IP; the 32-bit displacement at offset
+	 * `disp_offset' is adjusted so it still references the same address when the
+	 * instruction is run out of line.  Returns COMMAND_ERROR_DISPLACEMENT_OUT_OF_RANGE
+	 * without touching the target if the code buffer is too far away for that.
+	 */
+	ServerCommandError    (* execute_displaced_instruction) (ServerHandle     *handle,
+								 const guint8     *instruction,
+								 guint32           size,
+								 guint32           disp_offset);
+
 	ServerCommandError    (* mark_rti_frame)      (ServerHandle     *handle);
 
 	ServerCommandError    (* abort_invoke)        (ServerHandle     *handle,
@@ -356,6 +420,24 @@ struct InferiorVTable {
 	ServerCommandError    (* remove_breakpoint)   (ServerHandle     *handle,
 						       guint32           bhandle);
 
+	/*
+	 * Insert `count' breakpoints at `addresses' in one go and return their handles in
+	 * `bhandles'.  A handle is 0 if we couldn't insert that particular breakpoint;
+	 * the others are inserted nevertheless.
+	 */
+	ServerCommandError    (* insert_breakpoints)  (ServerHandle     *handle,
+						       guint32           count,
+						       const guint64    *addresses,
+						       guint32          *bhandles);
+
+	/*
+	 * Remove the `count' breakpoints in `bhandles' in one go.  Returns the first error,
+	 * but always tries to remove all of them.
+	 */
+	ServerCommandError    (* remove_breakpoints)  (ServerHandle     *handle,
+						       guint32           count,
+						       const guint32    *bhandles);
+
 	/*
 	 * Enables breakpoint `bhandle'.
 	 */
@@ -368,6 +450,16 @@ struct InferiorVTable {
 	ServerCommandError    (* disable_breakpoint)  (ServerHandle     *handle,
 						       guint32           bhandle);
 
+	/*
+	 * Set or clear (if `condition' is NULL) the condition of breakpoint `bhandle'.
+	 * When the breakpoint is hit and the condition is false, dispatch_event() steps over
+	 * the breakpoint, resumes the target and returns MESSAGE_CHILD_RESUMED; if it can't
+	 * do that, it reports the hit with `data1' set to 1.
+	 */
+	ServerCommandError    (* set_breakpoint_condition) (ServerHandle        *handle,
+							    guint32              bhandle,
+							    BreakpointCondition *condition);
+
 	/*
 	 * Get all breakpoints.  Writes number of breakpoints into `count' and returns a g_new0()
 	 * allocated list of guint32's in `breakpoints'.  The caller is responsible for freeing this
@@ -391,6 +483,18 @@ struct InferiorVTable {
 	ServerCommandError    (* set_registers)       (ServerHandle     *handle,
 						       guint64          *values);
 
+	/*
+	 * Get the processor registers of `count' stopped threads in one go; see
+	 * mono_debugger_server_get_registers_multiple().
+	 */
+	void                  (* get_registers_multiple) (guint32        count,
+							  ServerHandle **handles,
+							  guint32        num_registers,
+							  guint64       *values,
+							  guint32        stack_size,
+							  guint8        *stack,
+							  guint32       *results);
+
 	/*
 	 * Stop the target.
 	 */
@@ -418,6 +522,13 @@ struct InferiorVTable {
 						       guint32          *count,
 						       guint32         **threads);
 
+	/*
+	 * Cheaply get the number of threads in the target, so the caller can tell
+	 * whether it needs to call get_threads() at all.
+	 */
+	ServerCommandError    (* get_thread_count)    (ServerHandle     *handle,
+						       guint32          *count);
+
 	ServerCommandError    (* get_application)     (ServerHandle     *handle,
 						       gchar           **exe_file,
 						       gchar           **cwd,
@@ -497,6 +608,9 @@ mono_debugger_server_finalize             (ServerHandle       *handle);
 guint32
 mono_debugger_server_global_wait          (guint32                 *status);
 
+guint32
+mono_debugger_server_global_poll          (guint32                 *status);
+
 ServerStatusMessageType
 mono_debugger_server_dispatch_event       (ServerHandle            *handle,
 					   guint32                  status,
@@ -523,6 +637,11 @@ mono_debugger_server_current_insn_is_bpt  (ServerHandle       *handle,
 ServerCommandError
 mono_debugger_server_step                 (ServerHandle       *handle);
 
+ServerCommandError
+mono_debugger_server_step_range           (ServerHandle       *handle,
+					   guint64             start,
+					   guint64             end);
+
 ServerCommandError
 mono_debugger_server_continue             (ServerHandle       *handle);
 
@@ -549,6 +668,13 @@ mono_debugger_server_write_memory         (ServerHandle       *handle,
 					   guint32             size,
 					   gconstpointer       data);
 
+ServerCommandError
+mono_debugger_server_read_memory_vector   (ServerHandle       *handle,
+					   guint32             count,
+					   const guint64      *addresses,
+					   const guint32      *sizes,
+					   gpointer            data);
+
 ServerCommandError
 mono_debugger_server_call_method          (ServerHandle       *handle,
 					   guint64             method_address,
@@ -599,6 +725,12 @@ mono_debugger_execute_instruction         (ServerHandle        *handle,
 					   guint32              instruction_size,
 					   gboolean             update_ip);
 
+ServerCommandError
+mono_debugger_server_execute_displaced_instruction (ServerHandle        *handle,
+						    const guint8        *instruction,
+						    guint32              instruction_size,
+						    guint32              disp_offset);
+
 ServerCommandError
 mono_debugger_mark_rti_framenvoke        (ServerHandle        *handle);
 
@@ -622,6 +754,17 @@ ServerCommandError
 mono_debugger_server_remove_breakpoint   (ServerHandle        *handle,
 					  guint32              breakpoint);
 
+ServerCommandError
+mono_debugger_server_insert_breakpoints  (ServerHandle        *handle,
+					  guint32              count,
+					  const guint64       *addresses,
+					  guint32             *breakpoints);
+
+ServerCommandError
+mono_debugger_server_remove_breakpoints  (ServerHandle        *handle,
+					  guint32              count,
+					  const guint32       *breakpoints);
+
 ServerCommandError
 mono_debugger_server_enable_breakpoint   (ServerHandle        *handle,
 					  guint32              breakpoint);
@@ -630,6 +773,11 @@ ServerCommandError
 mono_debugger_server_disable_breakpoint  (ServerHandle        *handle,
 					  guint32              breakpoint);
 
+ServerCommandError
+mono_debugger_server_set_breakpoint_condition (ServerHandle        *handle,
+					       guint32              breakpoint,
+					       BreakpointCondition *condition);
+
 ServerCommandError
 mono_debugger_server_get_registers       (ServerHandle        *handle,
 					  guint64             *values);
@@ -638,6 +786,15 @@ ServerCommandError
 mono_debugger_server_set_registers       (ServerHandle        *handle,
 					  guint64             *values);
 
+void
+mono_debugger_server_get_registers_multiple (guint32          count,
+					     ServerHandle   **handles,
+					     guint32          num_registers,
+					     guint64         *values,
+					     guint32          stack_size,
+					     guint8          *stack,
+					     guint32         *results);
+
 ServerCommandError
 mono_debugger_server_stop                (ServerHandle        *handle);
 
@@ -645,6 +802,12 @@ ServerCommandError
 mono_debugger_server_stop_and_wait       (ServerHandle        *handle,
 					  guint32             *status);
 
+void
+mono_debugger_server_stop_all            (ServerHandle       **handles,
+					  guint32              count,
+					  guint32             *statuses,
+					  ServerCommandError  *results);
+
 ServerCommandError
 mono_debugger_server_set_signal          (ServerHandle        *handle,
 					  guint32              sig,
@@ -670,6 +833,10 @@ mono_debugger_server_get_threads         (ServerHandle        *handle,
 					  guint32             *count,
 					  guint32            **threads);
 
+ServerCommandError
+mono_debugger_server_get_thread_count    (ServerHandle        *handle,
+					  guint32             *count);
+
 ServerCommandError
 mono_debugger_server_get_application     (ServerHandle        *handle,
 					  gchar              **exe_file,
@@ -713,6 +880,13 @@ mono_debugger_server_initialize_code_buffer (MonoRuntimeInfo *runtime,
 					     guint64 executable_code_buffer,
 					     guint32 executable_code_buffer_size);
 
+void
+mono_debugger_server_get_runtime_slot_usage (MonoRuntimeInfo *runtime,
+					     guint32 *breakpoint_slots_used,
+					     guint32 *breakpoint_slots_total,
+					     guint32 *code_slots_used,
+					     guint32 *code_slots_total);
+
 void
 mono_debugger_server_get_registers_from_core_file (guint64 *values,
 						   const guint8 *buffer);
@@ -13,7 +13,9 @@ typedef enum {
 	STOP_ACTION_CALLBACK_COMPLETED,
 	STOP_ACTION_NOTIFICATION,
 	STOP_ACTION_RTI_DONE,
-	STOP_ACTION_INTERNAL_ERROR
+	STOP_ACTION_INTERNAL_ERROR,
+	STOP_ACTION_BREAKPOINT_IGNORED,
+	STOP_ACTION_RESUMED
 } ChildStoppedAction;
 
 typedef enum {
@@ -74,6 +76,9 @@ x86_arch_child_stopped (ServerHandle *handle, int stopsig,
 static ServerCommandError
 x86_arch_get_registers (ServerHandle *handle);
 
+static gboolean
+x86_arch_step_range_continue (ServerHandle *handle, guint64 start, guint64 end);
+
 static ServerCommandError
 x86_arch_disable_breakpoint (ServerHandle *handle, BreakpointInfo *breakpoint);
 
@@ -111,23 +111,117 @@ server_ptrace_read_memory (ServerHandle *handle, guint64 start, guint32 size, gp
 	return COMMAND_ERROR_NONE;
 }
 
+/*
+ * Maximum number of regions we pass to a single process_vm_readv() call;
+ * the kernel rejects anything above IOV_MAX (1024).
+ */
+#define READ_MEMORY_VECTOR_CHUNK	256
+
+static gboolean have_process_vm_readv = TRUE;
+
 static ServerCommandError
-server_ptrace_write_memory (ServerHandle *handle, guint64 start,
-			    guint32 size, gconstpointer buffer)
+_server_ptrace_read_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+				   const guint32 *sizes, gpointer buffer)
+{
+	ServerCommandError result;
+	guint8 *ptr = buffer;
+	guint32 i = 0;
+
+#ifdef __NR_process_vm_readv
+	while (have_process_vm_readv && (i < count)) {
+		struct iovec local [READ_MEMORY_VECTOR_CHUNK];
+		struct iovec remote [READ_MEMORY_VECTOR_CHUNK];
+		gsize offset = 0;
+		gssize ret;
+		guint32 n;
+
+		for (n = 0; (n < READ_MEMORY_VECTOR_CHUNK) && (i + n < count); n++) {
+			local [n].iov_base = ptr + offset;
+			local [n].iov_len = sizes [i + n];
+			remote [n].iov_base = GSIZE_TO_POINTER (addresses [i + n]);
+			remote [n].iov_len = sizes [i + n];
+			offset += sizes [i + n];
+		}
+
+		ret = syscall (__NR_process_vm_readv, handle->inferior->pid, local, n, remote, n, 0);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			/*
+			 * Either the kernel is too old or we're not allowed to use it
+			 * (Yama ptrace scope); don't try again.
+			 */
+			if ((errno == ENOSYS) || (errno == EPERM))
+				have_process_vm_readv = FALSE;
+			break;
+		}
+
+		/*
+		 * The kernel stops at the first region it can't read; skip over all the
+		 * regions which were read completely and let pread64() deal with the rest,
+		 * so we get the correct error code.
+		 */
+		while ((n > 0) && (ret >= (gssize) sizes [i])) {
+			ret -= sizes [i];
+			ptr += sizes [i];
+			i++;
+			n--;
+		}
+
+		if (n > 0)
+			break;
+	}
+#endif
+
+	for (; i < count; i++) {
+		result = _server_ptrace_read_memory (handle, addresses [i], sizes [i], ptr);
+		if (result != COMMAND_ERROR_NONE)
+			return result;
+
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
+}
+
+static ServerCommandError
+server_ptrace_read_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+				  const guint32 *sizes, gpointer buffer)
+{
+	ServerCommandError result;
+	guint8 *ptr = buffer;
+	guint32 i;
+
+	result = _server_ptrace_read_memory_vector (handle, count, addresses, sizes, buffer);
+	if (result != COMMAND_ERROR_NONE)
+		return result;
+
+	for (i = 0; i < count; i++) {
+		x86_arch_remove_breakpoints_from_target_memory (handle, addresses [i], sizes [i], ptr);
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
+}
+
+static ServerCommandError
+_server_ptrace_write_memory_ptrace (ServerHandle *handle, guint64 start,
+				    guint32 size, gconstpointer buffer)
 {
 	InferiorHandle *inferior = handle->inferior;
 	ServerCommandError result;
-	const long *ptr = buffer;
+	const guint8 *ptr = buffer;
 	guint64 addr = start;
-	char temp [8];
+	long word;
 
 	while (size >= sizeof (long)) {
-		long word = *ptr++;
+		memcpy (&word, ptr, sizeof (long));
 
 		errno = 0;
 		if (ptrace (PT_WRITE_D, inferior->pid, GSIZE_TO_POINTER (addr), word) != 0)
 			return _server_ptrace_check_errno (inferior);
 
+		ptr += sizeof (long);
 		addr += sizeof (long);
 		size -= sizeof (long);
 	}
@@ -135,13 +229,138 @@ server_ptrace_write_memory (ServerHandle *handle, guint64 start,
 	if (!size)
 		return COMMAND_ERROR_NONE;
 
-	result = _server_ptrace_read_memory (handle, addr, sizeof (long), &temp);
+	result = _server_ptrace_read_memory (handle, addr, sizeof (long), &word);
 	if (result != COMMAND_ERROR_NONE)
 		return result;
 
-	memcpy (&temp, ptr, size);
+	memcpy (&word, ptr, size);
+
+	errno = 0;
+	if (ptrace (PT_WRITE_D, inferior->pid, GSIZE_TO_POINTER (addr), word) != 0)
+		return _server_ptrace_check_errno (inferior);
+
+	return COMMAND_ERROR_NONE;
+}
+
+static ServerCommandError
+server_ptrace_write_memory (ServerHandle *handle, guint64 start,
+			    guint32 size, gconstpointer buffer)
+{
+	InferiorHandle *inferior = handle->inferior;
+	const guint8 *ptr = buffer;
+
+	/*
+	 * If we could open /proc/<pid>/mem for writing, that's a single syscall for the
+	 * whole region; unlike process_vm_writev(), it also works for read-only mappings
+	 * such as the target's text.  If it fails, we fall back to PT_WRITE_D for the rest
+	 * so we get the same error codes as before.
+	 */
+	while (inferior->os.mem_fd_writable && size) {
+		gssize ret = pwrite64 (inferior->os.mem_fd, ptr, size, start);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			else if (errno == ESRCH)
+				return COMMAND_ERROR_NOT_STOPPED;
+			else if (errno == EINVAL)
+				/* Kernels before 2.6.39 don't allow writing to /proc/<pid>/mem. */
+				inferior->os.mem_fd_writable = FALSE;
+			break;
+		} else if (!ret)
+			break;
+
+		ptr += ret;
+		start += ret;
+		size -= ret;
+	}
+
+	if (!size)
+		return COMMAND_ERROR_NONE;
+
+	return _server_ptrace_write_memory_ptrace (handle, start, size, ptr);
+}
+
+static gboolean have_process_vm_writev = TRUE;
+
+/*
+ * Write `count' regions, which should be sorted by address, in one go.
+ *
+ * process_vm_writev() only works on writable mappings, like the JIT's code buffers
+ * or the runtime's breakpoint table, so everything it can't write - most notably
+ * read-only text pages - is written with server_ptrace_write_memory() instead.  When
+ * that happens, we also write the remaining regions on the same page that way, rather
+ * than letting process_vm_writev() fail on each of them.
+ */
+static ServerCommandError
+_server_ptrace_write_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+				    const guint32 *sizes, gconstpointer buffer)
+{
+	ServerCommandError result;
+	const guint8 *ptr = buffer;
+	guint32 i = 0;
+
+#ifdef __NR_process_vm_writev
+	guint64 page_mask = ~((guint64) getpagesize () - 1);
+
+	while (have_process_vm_writev && (i < count)) {
+		struct iovec local [READ_MEMORY_VECTOR_CHUNK];
+		struct iovec remote [READ_MEMORY_VECTOR_CHUNK];
+		gsize offset = 0;
+		gssize ret;
+		guint64 page;
+		guint32 n;
+
+		for (n = 0; (n < READ_MEMORY_VECTOR_CHUNK) && (i + n < count); n++) {
+			local [n].iov_base = (gpointer) (ptr + offset);
+			local [n].iov_len = sizes [i + n];
+			remote [n].iov_base = GSIZE_TO_POINTER (addresses [i + n]);
+			remote [n].iov_len = sizes [i + n];
+			offset += sizes [i + n];
+		}
+
+		ret = syscall (__NR_process_vm_writev, handle->inferior->pid, local, n, remote, n, 0);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			if ((errno == ENOSYS) || (errno == EPERM)) {
+				have_process_vm_writev = FALSE;
+				break;
+			}
+			/* The very first region is not writable. */
+			ret = 0;
+		}
+
+		while ((n > 0) && (ret >= (gssize) sizes [i])) {
+			ret -= sizes [i];
+			ptr += sizes [i];
+			i++;
+			n--;
+		}
+
+		if (!n)
+			continue;
+
+		page = addresses [i] & page_mask;
+		while ((i < count) && ((addresses [i] & page_mask) == page)) {
+			result = server_ptrace_write_memory (handle, addresses [i], sizes [i], ptr);
+			if (result != COMMAND_ERROR_NONE)
+				return result;
 
-	return server_ptrace_write_memory (handle, addr, sizeof (long), &temp);
+			ptr += sizes [i];
+			i++;
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		result = server_ptrace_write_memory (handle, addresses [i], sizes [i], ptr);
+		if (result != COMMAND_ERROR_NONE)
+			return result;
+
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
 }
 
 static ServerCommandError
@@ -254,6 +473,71 @@ do_wait (int pid, guint32 *status, gboolean nohang)
 static int stop_requested = 0;
 static int stop_status = 0;
 
+/*
+ * The threads server_ptrace_stop_all() is waiting for; protected by the
+ * `wait_mutex_2'.
+ */
+static int *stop_all_pids = NULL;
+static guint32 stop_all_count = 0;
+
+static gboolean
+_server_ptrace_is_stop_all_pid (int pid)
+{
+	guint32 i;
+
+	for (i = 0; i < stop_all_count; i++) {
+		if (stop_all_pids [i] == pid)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+/*
+ * Events which have already been reaped by server_ptrace_step_range(), but not
+ * reported yet.  Protected by the `wait_mutex'.
+ */
+typedef struct {
+	int pid;
+	guint32 status;
+} PendingStatus;
+
+static GSList *pending_statuses = NULL;
+
+static void
+_server_ptrace_add_pending_status (int pid, guint32 status)
+{
+	PendingStatus *pending = g_new0 (PendingStatus, 1);
+
+	pending->pid = pid;
+	pending->status = status;
+
+	pending_statuses = g_slist_append (pending_statuses, pending);
+}
+
+static int
+_server_ptrace_get_pending_status (int pid, guint32 *status)
+{
+	GSList *l;
+
+	for (l = pending_statuses; l; l = l->next) {
+		PendingStatus *pending = l->data;
+		int ret;
+
+		if ((pid > 0) && (pending->pid != pid))
+			continue;
+
+		ret = pending->pid;
+		*status = pending->status;
+
+		pending_statuses = g_slist_remove (pending_statuses, pending);
+		g_free (pending);
+		return ret;
+	}
+
+	return 0;
+}
+
 static guint32
 server_ptrace_global_wait (guint32 *status_ret)
 {
@@ -261,7 +545,9 @@ server_ptrace_global_wait (guint32 *status_ret)
 
  again:
 	g_static_mutex_lock (&wait_mutex);
-	ret = do_wait (-1, &status, FALSE);
+	ret = _server_ptrace_get_pending_status (-1, &status);
+	if (!ret)
+		ret = do_wait (-1, &status, FALSE);
 	if (ret <= 0)
 		goto out;
 
@@ -282,6 +568,18 @@ server_ptrace_global_wait (guint32 *status_ret)
 		g_static_mutex_unlock (&wait_mutex_2);
 		g_static_mutex_unlock (&wait_mutex);
 
+		g_static_mutex_lock (&wait_mutex_3);
+		g_static_mutex_unlock (&wait_mutex_3);
+		goto again;
+	} else if (_server_ptrace_is_stop_all_pid (ret)) {
+		/*
+		 * Hand it to server_ptrace_stop_all(), which is waiting for us to
+		 * release the `wait_mutex'.
+		 */
+		_server_ptrace_add_pending_status (ret, status);
+		g_static_mutex_unlock (&wait_mutex_2);
+		g_static_mutex_unlock (&wait_mutex);
+
 		g_static_mutex_lock (&wait_mutex_3);
 		g_static_mutex_unlock (&wait_mutex_3);
 		goto again;
@@ -294,6 +592,35 @@ server_ptrace_global_wait (guint32 *status_ret)
 	return ret;
 }
 
+static guint32
+server_ptrace_global_poll (guint32 *status_ret)
+{
+	guint32 status;
+	int ret;
+
+	/*
+	 * If the wait thread is currently blocking in waitpid(), it'll get the
+	 * next event anyways.
+	 */
+	if (!g_static_mutex_trylock (&wait_mutex))
+		return 0;
+
+	ret = _server_ptrace_get_pending_status (-1, &status);
+	if (!ret)
+		ret = do_wait (-1, &status, TRUE);
+	g_static_mutex_unlock (&wait_mutex);
+
+	if (ret <= 0)
+		return 0;
+
+#if DEBUG_WAIT
+	g_message (G_STRLOC ": global poll finished: %d - %x", ret, status);
+#endif
+
+	*status_ret = status;
+	return ret;
+}
+
 static gboolean
 _server_ptrace_wait_for_new_thread (ServerHandle *handle)
 {
@@ -430,6 +757,12 @@ server_ptrace_stop_and_wait (ServerHandle *handle, guint32 *status)
 
 	stop_requested = stop_status = 0;
 
+	if (_server_ptrace_get_pending_status (handle->inferior->pid, status)) {
+		g_static_mutex_unlock (&wait_mutex);
+		g_static_mutex_unlock (&wait_mutex_3);
+		return COMMAND_ERROR_NONE;
+	}
+
 	do {
 #if DEBUG_WAIT
 		g_message (G_STRLOC ": %d - waiting", handle->inferior->pid);
@@ -452,6 +785,283 @@ server_ptrace_stop_and_wait (ServerHandle *handle, guint32 *status)
 	return COMMAND_ERROR_NONE;
 }
 
+static void
+server_ptrace_stop_all (ServerHandle **handles, guint32 count, guint32 *statuses,
+			ServerCommandError *results)
+{
+	gboolean *already_stopped;
+	guint32 i, remaining = 0;
+	int *pids;
+
+	pids = g_new0 (int, count);
+	already_stopped = g_new0 (gboolean, count);
+
+	/*
+	 * Send a SIGSTOP to all the threads before waiting for any of them.
+	 */
+	g_static_mutex_lock (&wait_mutex_2);
+	for (i = 0; i < count; i++) {
+		statuses [i] = 0;
+		results [i] = server_ptrace_stop (handles [i]);
+		if (results [i] == COMMAND_ERROR_ALREADY_STOPPED) {
+			already_stopped [i] = TRUE;
+			results [i] = COMMAND_ERROR_NONE;
+		} else if (results [i] != COMMAND_ERROR_NONE)
+			continue;
+
+		pids [i] = handles [i]->inferior->pid;
+		remaining++;
+	}
+
+	/*
+	 * Same protocol as in server_ptrace_stop_and_wait(): if the wait thread is
+	 * currently blocking in waitpid(), it'll queue the event for us and then
+	 * block on the `wait_mutex_3' until we're done.
+	 */
+	g_static_mutex_lock (&wait_mutex_3);
+	stop_all_pids = pids;
+	stop_all_count = count;
+	g_static_mutex_unlock (&wait_mutex_2);
+
+	g_static_mutex_lock (&wait_mutex);
+
+	for (i = 0; i < count; i++) {
+		if (!pids [i])
+			continue;
+
+		if (_server_ptrace_get_pending_status (pids [i], &statuses [i]) ||
+		    (already_stopped [i] && (do_wait (pids [i], &statuses [i], TRUE) > 0))) {
+			pids [i] = 0;
+			remaining--;
+		} else if (already_stopped [i]) {
+			/*
+			 * Its stop has already been reported.
+			 */
+			statuses [i] = 0;
+			pids [i] = 0;
+			remaining--;
+		}
+	}
+
+	/*
+	 * Now reap them in one pass; anything else we get is queued for
+	 * server_ptrace_global_wait().
+	 */
+	while (remaining > 0) {
+		guint32 status;
+		int ret;
+
+		ret = do_wait (-1, &status, FALSE);
+		if (ret == 0)
+			continue;
+		else if (ret < 0)
+			break;
+
+		for (i = 0; i < count; i++) {
+			if (pids [i] == ret)
+				break;
+		}
+
+		if (i < count) {
+			statuses [i] = status;
+			pids [i] = 0;
+			remaining--;
+		} else {
+			_server_ptrace_add_pending_status (ret, status);
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		if (pids [i])
+			results [i] = COMMAND_ERROR_NO_TARGET;
+	}
+
+	stop_all_pids = NULL;
+	stop_all_count = 0;
+
+	g_static_mutex_unlock (&wait_mutex);
+	g_static_mutex_unlock (&wait_mutex_3);
+
+	g_free (already_stopped);
+	g_free (pids);
+}
+
+/*
+ * Maximum number of instructions we step in server_ptrace_step_range() before
+ * reporting back, so the engine thread doesn't become unresponsive.
+ */
+#define STEP_RANGE_MAX_STEPS	65536
+
+static ServerCommandError
+server_ptrace_step_range (ServerHandle *handle, guint64 start, guint64 end)
+{
+	InferiorHandle *inferior = handle->inferior;
+	ServerCommandError result;
+	int steps;
+
+	if (!x86_arch_step_range_continue (handle, start, end))
+		return server_ptrace_step (handle);
+
+	/*
+	 * We can only wait for the target here if nobody else is currently doing so.
+	 * This is normally the case while the engine thread is processing an event;
+	 * if it isn't, just do a normal single-step.
+	 */
+	if (!g_static_mutex_trylock (&wait_mutex))
+		return server_ptrace_step (handle);
+
+	result = server_ptrace_step (handle);
+	if (result != COMMAND_ERROR_NONE) {
+		g_static_mutex_unlock (&wait_mutex);
+		return result;
+	}
+
+	for (steps = 1; ; steps++) {
+		guint32 status;
+		int ret;
+
+		do {
+			ret = do_wait (inferior->pid, &status, FALSE);
+		} while (ret == 0);
+
+		if (ret < 0) {
+			/*
+			 * Nothing will be reported for this step, so the caller must
+			 * not wait for it.
+			 */
+			result = COMMAND_ERROR_INTERNAL_ERROR;
+			break;
+		}
+
+		if (!(status >> 16) && WIFSTOPPED (status) && (WSTOPSIG (status) == SIGTRAP) &&
+		    (steps < STEP_RANGE_MAX_STEPS) &&
+		    x86_arch_step_range_continue (handle, start, end)) {
+			inferior->last_signal = 0;
+			if (server_ptrace_step (handle) == COMMAND_ERROR_NONE)
+				continue;
+		}
+
+		/*
+		 * Let server_ptrace_global_wait() report this event.
+		 */
+		_server_ptrace_add_pending_status (ret, status);
+		break;
+	}
+
+	g_static_mutex_unlock (&wait_mutex);
+	return result;
+}
+
+/*
+ * Step over breakpoint `idx' after its condition turned out to be false and resume the
+ * target, without reporting anything to the engine.
+ *
+ * We execute the original instruction out of line, in the Mono runtime's executable code
+ * buffer, so the breakpoint remains inserted and other threads can't miss it while we're
+ * stepping.  Returns STOP_ACTION_BREAKPOINT_HIT if we can't do that, so the caller must
+ * report the hit.
+ */
+static ChildStoppedAction
+_server_ptrace_skip_breakpoint (ServerHandle *handle, guint32 idx)
+{
+	InferiorHandle *inferior = handle->inferior;
+	BreakpointInfo *breakpoint;
+	guint8 insn [BREAKPOINT_CONDITION_MAX_INSN_SIZE];
+	guint32 insn_size = 0;
+	gboolean interrupted = FALSE;
+	ChildStoppedAction action;
+
+	if (inferior->stepping || !handle->mono_runtime ||
+	    !handle->mono_runtime->executable_code_buffer)
+		return STOP_ACTION_BREAKPOINT_HIT;
+
+	mono_debugger_breakpoint_manager_lock ();
+	breakpoint = mono_debugger_breakpoint_manager_lookup_by_id (handle->bpm, idx);
+	if (breakpoint && breakpoint->has_condition) {
+		insn_size = breakpoint->condition.insn_size;
+		memcpy (insn, breakpoint->condition.insn, insn_size);
+	}
+	mono_debugger_breakpoint_manager_unlock ();
+
+	if (!insn_size)
+		return STOP_ACTION_BREAKPOINT_HIT;
+
+	/*
+	 * Like server_ptrace_step_range(), we may only wait here if nobody else is.
+	 */
+	if (!g_static_mutex_trylock (&wait_mutex))
+		return STOP_ACTION_BREAKPOINT_HIT;
+
+	if (server_ptrace_execute_instruction (handle, insn, insn_size, TRUE) != COMMAND_ERROR_NONE) {
+		g_static_mutex_unlock (&wait_mutex);
+		return STOP_ACTION_INTERNAL_ERROR;
+	}
+
+	while (TRUE) {
+		guint64 callback_arg, retval, retval2;
+		guint32 opt_data_size;
+		gpointer opt_data;
+		guint32 status;
+		int ret;
+
+		do {
+			ret = do_wait (inferior->pid, &status, FALSE);
+		} while (ret == 0);
+
+		/*
+		 * We can't tell where the target is now; don't claim it's running.
+		 */
+		if (ret < 0) {
+			g_static_mutex_unlock (&wait_mutex);
+			return STOP_ACTION_INTERNAL_ERROR;
+		}
+
+		/*
+		 * Somebody stopped us while we were stepping; suppress the SIGSTOP, finish the
+		 * step and report the target as interrupted.
+		 */
+		if (!(status >> 16) && WIFSTOPPED (status) && (WSTOPSIG (status) == SIGSTOP)) {
+			interrupted = TRUE;
+			inferior->last_signal = 0;
+			if (server_ptrace_step (handle) == COMMAND_ERROR_NONE)
+				continue;
+		}
+
+		if ((status >> 16) || !WIFSTOPPED (status) || (WSTOPSIG (status) != SIGTRAP)) {
+			/*
+			 * Let server_ptrace_global_wait() report this event; x86_arch_child_stopped()
+			 * cleans up the code buffer once the step is completed.
+			 */
+			_server_ptrace_add_pending_status (ret, status);
+			g_static_mutex_unlock (&wait_mutex);
+			return STOP_ACTION_RESUMED;
+		}
+
+		action = x86_arch_child_stopped (
+			handle, SIGTRAP, &callback_arg, &retval, &retval2, &opt_data_size, &opt_data);
+		break;
+	}
+
+	if (action != STOP_ACTION_STOPPED) {
+		g_static_mutex_unlock (&wait_mutex);
+		return STOP_ACTION_INTERNAL_ERROR;
+	}
+
+	if (interrupted) {
+		g_static_mutex_unlock (&wait_mutex);
+		return STOP_ACTION_INTERRUPTED;
+	}
+
+	inferior->last_signal = 0;
+	if (server_ptrace_continue (handle) != COMMAND_ERROR_NONE) {
+		g_static_mutex_unlock (&wait_mutex);
+		return STOP_ACTION_INTERNAL_ERROR;
+	}
+
+	g_static_mutex_unlock (&wait_mutex);
+	return STOP_ACTION_RESUMED;
+}
+
 static ServerCommandError
 _server_ptrace_setup_inferior (ServerHandle *handle)
 {
@@ -459,7 +1069,10 @@ _server_ptrace_setup_inferior (ServerHandle *handle)
 
 	x86_arch_remove_hardware_breakpoints (handle);
 
-	handle->inferior->os.mem_fd = open64 (filename, O_RDONLY);
+	handle->inferior->os.mem_fd = open64 (filename, O_RDWR);
+	handle->inferior->os.mem_fd_writable = handle->inferior->os.mem_fd >= 0;
+	if (handle->inferior->os.mem_fd < 0)
+		handle->inferior->os.mem_fd = open64 (filename, O_RDONLY);
 
 	if (handle->inferior->os.mem_fd < 0) {
 		if (errno == EACCES)
@@ -583,6 +1196,27 @@ server_ptrace_get_threads (ServerHandle *handle, guint32 *count, guint32 **threa
 	return COMMAND_ERROR_UNKNOWN_ERROR;
 }
 
+/*
+ * The link count of /proc/<pid>/task is the number of threads plus two, so a
+ * single stat() tells us whether any threads came or went without reading the
+ * directory.
+ */
+static ServerCommandError
+server_ptrace_get_thread_count (ServerHandle *handle, guint32 *count)
+{
+	gchar *dirname = g_strdup_printf ("/proc/%d/task", handle->inferior->pid);
+	struct stat st;
+
+	if (stat (dirname, &st) || (st.st_nlink < 3)) {
+		g_free (dirname);
+		return COMMAND_ERROR_NOT_IMPLEMENTED;
+	}
+
+	*count = st.st_nlink - 2;
+	g_free (dirname);
+	return COMMAND_ERROR_NONE;
+}
+
 static ServerCommandError
 server_ptrace_get_application (ServerHandle *handle, gchar **exe_file, gchar **cwd,
 			       guint32 *nargs, gchar ***cmdline_args)
@@ -6,6 +6,7 @@
 struct OSData
 {
 	int mem_fd;
+	gboolean mem_fd_writable;
 };
 
 #include "x86-ptrace.h"
@@ -12,6 +12,7 @@
 #include <sys/stat.h>
 #include <sys/ptrace.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 #include <sys/poll.h>
 #include <sys/select.h>
@@ -51,6 +52,76 @@ struct IOThreadData
 	int output_fd, error_fd;
 };
 
+#define SLOT_TABLE_WORD_BITS		(sizeof (gulong) * 8)
+
+static void
+runtime_slot_table_init (RuntimeSlotTable *table, guint32 size, guint32 reserved)
+{
+	guint32 nwords, i;
+
+	g_free (table->bits);
+
+	nwords = (size + SLOT_TABLE_WORD_BITS - 1) / SLOT_TABLE_WORD_BITS;
+
+	table->size = size;
+	table->reserved = MIN (reserved, size);
+	table->used = 0;
+	table->hint = 0;
+	table->bits = g_new0 (gulong, MAX (nwords, 1));
+
+	/*
+	 * Mark the reserved slots and the padding bits in the last word as used, so
+	 * the allocator never needs to check the bounds.
+	 */
+	for (i = 0; i < table->reserved; i++)
+		table->bits [i / SLOT_TABLE_WORD_BITS] |= 1UL << (i % SLOT_TABLE_WORD_BITS);
+	for (i = size; i < nwords * SLOT_TABLE_WORD_BITS; i++)
+		table->bits [i / SLOT_TABLE_WORD_BITS] |= 1UL << (i % SLOT_TABLE_WORD_BITS);
+}
+
+static int
+runtime_slot_table_alloc (RuntimeSlotTable *table)
+{
+	guint32 nwords, i;
+
+	if (table->used + table->reserved >= table->size)
+		return -1;
+
+	nwords = (table->size + SLOT_TABLE_WORD_BITS - 1) / SLOT_TABLE_WORD_BITS;
+
+	for (i = 0; i < nwords; i++) {
+		guint32 word = (table->hint + i) % nwords;
+		gint bit;
+
+		if (table->bits [word] == ~0UL)
+			continue;
+
+		bit = g_bit_nth_lsf (~table->bits [word], -1);
+		table->bits [word] |= 1UL << bit;
+		table->used++;
+		table->hint = word;
+		return word * SLOT_TABLE_WORD_BITS + bit;
+	}
+
+	return -1;
+}
+
+static void
+runtime_slot_table_free (RuntimeSlotTable *table, int slot)
+{
+	gulong mask;
+
+	if ((slot < (int) table->reserved) || (slot >= (int) table->size))
+		return;
+
+	mask = 1UL << (slot % SLOT_TABLE_WORD_BITS);
+	if (!(table->bits [slot / SLOT_TABLE_WORD_BITS] & mask))
+		return;
+
+	table->bits [slot / SLOT_TABLE_WORD_BITS] &= ~mask;
+	table->used--;
+}
+
 MonoRuntimeInfo *
 mono_debugger_server_initialize_mono_runtime (guint32 address_size,
 					      guint64 notification_address,
@@ -73,8 +144,10 @@ mono_debugger_server_initialize_mono_runtime (guint32 address_size,
 	runtime->breakpoint_table = breakpoint_table;
 	runtime->breakpoint_table_size = breakpoint_table_size;
 
-	runtime->breakpoint_table_bitfield = g_malloc0 (breakpoint_table_size);
-	runtime->executable_code_bitfield = g_malloc0 (runtime->executable_code_total_chunks);
+	/* Slot 0 of the breakpoint table means "no breakpoint". */
+	runtime_slot_table_init (&runtime->breakpoint_table_slots, breakpoint_table_size, 1);
+	runtime_slot_table_init (&runtime->executable_code_slots,
+				 runtime->executable_code_total_chunks, 0);
 
 	return runtime;
 }
@@ -88,6 +161,27 @@ mono_debugger_server_initialize_code_buffer (MonoRuntimeInfo *runtime,
 	runtime->executable_code_buffer_size = executable_code_buffer_size;
 	runtime->executable_code_chunk_size = EXECUTABLE_CODE_CHUNK_SIZE;
 	runtime->executable_code_total_chunks = executable_code_buffer_size / EXECUTABLE_CODE_CHUNK_SIZE;
+
+	runtime_slot_table_init (&runtime->executable_code_slots,
+				 runtime->executable_code_total_chunks, 0);
+}
+
+void
+mono_debugger_server_get_runtime_slot_usage (MonoRuntimeInfo *runtime,
+					     guint32 *breakpoint_slots_used,
+					     guint32 *breakpoint_slots_total,
+					     guint32 *code_slots_used,
+					     guint32 *code_slots_total)
+{
+	RuntimeSlotTable *table;
+
+	table = &runtime->breakpoint_table_slots;
+	*breakpoint_slots_used = table->used;
+	*breakpoint_slots_total = table->size - table->reserved;
+
+	table = &runtime->executable_code_slots;
+	*code_slots_used = table->used;
+	*code_slots_total = table->size - table->reserved;
 }
 
 void
@@ -232,6 +326,25 @@ server_ptrace_dispatch_event (ServerHandle *handle, guint32 status, guint64 *arg
 
 		case STOP_ACTION_BREAKPOINT_HIT:
 			*arg = (int) retval;
+			*data1 = 0;
+			return MESSAGE_CHILD_HIT_BREAKPOINT;
+
+		case STOP_ACTION_BREAKPOINT_IGNORED:
+#ifdef __linux__
+			action = _server_ptrace_skip_breakpoint (handle, (guint32) retval);
+			if (action == STOP_ACTION_RESUMED)
+				return MESSAGE_CHILD_RESUMED;
+			else if (action == STOP_ACTION_INTERRUPTED) {
+				*arg = 0;
+				return MESSAGE_CHILD_INTERRUPTED;
+			} else if (action == STOP_ACTION_INTERNAL_ERROR)
+				return MESSAGE_INTERNAL_ERROR;
+#endif
+			/*
+			 * We can't step over the breakpoint here, so let the engine do it.
+			 */
+			*arg = (int) retval;
+			*data1 = 1;
 			return MESSAGE_CHILD_HIT_BREAKPOINT;
 
 		case STOP_ACTION_CALLBACK:
@@ -258,6 +371,9 @@ server_ptrace_dispatch_event (ServerHandle *handle, guint32 status, guint64 *arg
 			*data2 = retval2;
 			return MESSAGE_RUNTIME_INVOKE_DONE;
 
+		case STOP_ACTION_RESUMED:
+			return MESSAGE_CHILD_RESUMED;
+
 		case STOP_ACTION_INTERNAL_ERROR:
 			return MESSAGE_INTERNAL_ERROR;
 		}
@@ -597,6 +713,527 @@ extern void GC_end_blocking (void);
 #error "Unknown architecture"
 #endif
 
+static ServerCommandError
+server_ptrace_set_breakpoint_condition (ServerHandle *handle, guint32 idx,
+					BreakpointCondition *condition)
+{
+	BreakpointInfo *breakpoint;
+
+	if (condition && (condition->insn_size > BREAKPOINT_CONDITION_MAX_INSN_SIZE))
+		return COMMAND_ERROR_INTERNAL_ERROR;
+
+	/*
+	 * evaluate_breakpoint_condition() reads the operand into an 8-byte buffer.
+	 */
+	if (condition && (condition->type == BREAKPOINT_CONDITION_MEMORY) &&
+	    (condition->size != 1) && (condition->size != 2) &&
+	    (condition->size != 4) && (condition->size != 8))
+		return COMMAND_ERROR_INTERNAL_ERROR;
+
+	mono_debugger_breakpoint_manager_lock ();
+	breakpoint = mono_debugger_breakpoint_manager_lookup_by_id (handle->bpm, idx);
+	if (!breakpoint) {
+		mono_debugger_breakpoint_manager_unlock ();
+		return COMMAND_ERROR_NO_SUCH_BREAKPOINT;
+	}
+
+	breakpoint->sample_count = 0;
+	if (condition) {
+		breakpoint->condition = *condition;
+		breakpoint->has_condition = TRUE;
+	} else {
+		memset (&breakpoint->condition, 0, sizeof (BreakpointCondition));
+		breakpoint->has_condition = FALSE;
+	}
+	mono_debugger_breakpoint_manager_unlock ();
+
+	return COMMAND_ERROR_NONE;
+}
+
+static gboolean
+evaluate_breakpoint_condition (ServerHandle *handle, BreakpointCondition *condition)
+{
+	guint64 regs [DEBUGGER_REG_LAST];
+	gint64 operand;
+
+	if (condition->type == BREAKPOINT_CONDITION_NONE)
+		return TRUE;
+
+	if ((condition->reg >= 0) &&
+	    ((condition->reg >= DEBUGGER_REG_LAST) ||
+	     (server_ptrace_get_registers (handle, regs) != COMMAND_ERROR_NONE)))
+		return TRUE;
+
+	if (condition->type == BREAKPOINT_CONDITION_REGISTER) {
+		if (condition->reg < 0)
+			return TRUE;
+
+		operand = (gint64) regs [condition->reg];
+	} else if (condition->type == BREAKPOINT_CONDITION_MEMORY) {
+		guint64 address = condition->offset;
+		union {
+			gint8 i8;
+			gint16 i16;
+			gint32 i32;
+			gint64 i64;
+		} buffer;
+
+		if (condition->size > sizeof (buffer))
+			return TRUE;
+
+		if (condition->reg >= 0)
+			address += regs [condition->reg];
+
+		if (server_ptrace_read_memory (handle, address, condition->size, &buffer) != COMMAND_ERROR_NONE)
+			return TRUE;
+
+		switch (condition->size) {
+		case 1:
+			operand = buffer.i8;
+			break;
+		case 2:
+			operand = buffer.i16;
+			break;
+		case 4:
+			operand = buffer.i32;
+			break;
+		case 8:
+			operand = buffer.i64;
+			break;
+		default:
+			return TRUE;
+		}
+	} else
+		return TRUE;
+
+	switch (condition->op) {
+	case BREAKPOINT_CONDITION_EQ:
+		return operand == condition->value;
+	case BREAKPOINT_CONDITION_NE:
+		return operand != condition->value;
+	case BREAKPOINT_CONDITION_LT:
+		return operand < condition->value;
+	case BREAKPOINT_CONDITION_LE:
+		return operand <= condition->value;
+	case BREAKPOINT_CONDITION_GT:
+		return operand > condition->value;
+	case BREAKPOINT_CONDITION_GE:
+		return operand >= condition->value;
+	default:
+		return TRUE;
+	}
+}
+
+/*
+ * Called from x86_arch_child_stopped() when we hit breakpoint `idx'; counts the hit and
+ * returns FALSE if the target should not stop there.  If we can't evaluate the condition,
+ * for instance because we can't read the memory, we always stop.
+ */
+static gboolean
+_server_ptrace_check_breakpoint_condition (ServerHandle *handle, guint32 idx)
+{
+	BreakpointInfo *breakpoint;
+	BreakpointCondition *condition;
+	gboolean retval = TRUE;
+
+	mono_debugger_breakpoint_manager_lock ();
+	breakpoint = mono_debugger_breakpoint_manager_lookup_by_id (handle->bpm, idx);
+	if (!breakpoint)
+		goto out;
+
+	if (!breakpoint->has_condition) {
+		breakpoint->hit_count++;
+		goto out;
+	}
+
+	condition = &breakpoint->condition;
+	if (condition->thread && (condition->thread != handle->inferior->pid)) {
+		retval = FALSE;
+		goto out;
+	}
+
+	if (!evaluate_breakpoint_condition (handle, condition)) {
+		retval = FALSE;
+		goto out;
+	}
+
+	breakpoint->hit_count++;
+
+	if (condition->ignore_count > 0) {
+		condition->ignore_count--;
+		retval = FALSE;
+	} else if (condition->count_only)
+		retval = FALSE;
+	else if (condition->sample_interval > 1) {
+		/*
+		 * Don't count the ignored hits, so the first stop is the
+		 * `sample_interval'th hit after the ignore count ran out.
+		 */
+		breakpoint->sample_count++;
+		retval = (breakpoint->sample_count % condition->sample_interval) == 0;
+	}
+
+ out:
+	mono_debugger_breakpoint_manager_unlock ();
+	return retval;
+}
+
+static ServerCommandError
+read_raw_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+			const guint32 *sizes, gpointer buffer)
+{
+#ifdef __linux__
+	return _server_ptrace_read_memory_vector (handle, count, addresses, sizes, buffer);
+#else
+	ServerCommandError result;
+	guint8 *ptr = buffer;
+	guint32 i;
+
+	for (i = 0; i < count; i++) {
+		result = _server_ptrace_read_memory (handle, addresses [i], sizes [i], ptr);
+		if (result != COMMAND_ERROR_NONE)
+			return result;
+
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
+#endif
+}
+
+static ServerCommandError
+write_memory_vector (ServerHandle *handle, guint32 count, const guint64 *addresses,
+		     const guint32 *sizes, gconstpointer buffer)
+{
+#ifdef __linux__
+	return _server_ptrace_write_memory_vector (handle, count, addresses, sizes, buffer);
+#else
+	ServerCommandError result;
+	const guint8 *ptr = buffer;
+	guint32 i;
+
+	for (i = 0; i < count; i++) {
+		result = server_ptrace_write_memory (handle, addresses [i], sizes [i], ptr);
+		if (result != COMMAND_ERROR_NONE)
+			return result;
+
+		ptr += sizes [i];
+	}
+
+	return COMMAND_ERROR_NONE;
+#endif
+}
+
+static gint
+compare_breakpoint_address (gconstpointer a, gconstpointer b)
+{
+	const BreakpointInfo *b1 = *(const BreakpointInfo **) a;
+	const BreakpointInfo *b2 = *(const BreakpointInfo **) b;
+
+	if (b1->address < b2->address)
+		return -1;
+	else if (b1->address > b2->address)
+		return 1;
+	return 0;
+}
+
+/*
+ * Read the original instructions of all the `new_bpts' and write their breakpoint
+ * opcodes with one vectored read and write each; if the vectored operation fails,
+ * we find the breakpoints which are to blame one by one.  Returns the breakpoints
+ * which couldn't be enabled in `failed'.
+ */
+static void
+enable_breakpoints (ServerHandle *handle, GPtrArray *new_bpts, GPtrArray *failed)
+{
+	GPtrArray *enabled;
+	guint64 *addresses;
+	guint32 *sizes;
+	guint8 *data;
+	gboolean *read_ok;
+	guint32 count, i;
+
+	count = new_bpts->len;
+	addresses = g_new0 (guint64, count);
+	sizes = g_new0 (guint32, count);
+	data = g_new0 (guint8, count);
+	read_ok = g_new0 (gboolean, count);
+	enabled = g_ptr_array_new ();
+
+	for (i = 0; i < count; i++) {
+		BreakpointInfo *breakpoint = g_ptr_array_index (new_bpts, i);
+
+		addresses [i] = breakpoint->address;
+		sizes [i] = 1;
+	}
+
+	if (read_raw_memory_vector (handle, count, addresses, sizes, data) == COMMAND_ERROR_NONE) {
+		for (i = 0; i < count; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (new_bpts, i);
+
+			breakpoint->saved_insn = data [i];
+			read_ok [i] = TRUE;
+		}
+	} else {
+		for (i = 0; i < count; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (new_bpts, i);
+
+			read_ok [i] = _server_ptrace_read_memory (
+				handle, breakpoint->address, 1, &breakpoint->saved_insn) == COMMAND_ERROR_NONE;
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		BreakpointInfo *breakpoint = g_ptr_array_index (new_bpts, i);
+
+		if (!read_ok [i]) {
+			g_ptr_array_add (failed, breakpoint);
+			continue;
+		}
+
+		if (handle->mono_runtime &&
+		    (runtime_info_enable_breakpoint (handle, breakpoint) != COMMAND_ERROR_NONE)) {
+			g_ptr_array_add (failed, breakpoint);
+			continue;
+		}
+
+		addresses [enabled->len] = breakpoint->address;
+		data [enabled->len] = 0xcc;
+		g_ptr_array_add (enabled, breakpoint);
+	}
+
+	if (write_memory_vector (handle, enabled->len, addresses, sizes, data) != COMMAND_ERROR_NONE) {
+		char bopcode = 0xcc;
+
+		for (i = 0; i < enabled->len; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (enabled, i);
+
+			if (server_ptrace_write_memory (handle, breakpoint->address, 1, &bopcode) != COMMAND_ERROR_NONE) {
+				if (handle->mono_runtime)
+					runtime_info_disable_breakpoint (handle, breakpoint);
+				g_ptr_array_add (failed, breakpoint);
+				continue;
+			}
+
+			breakpoint->enabled = TRUE;
+		}
+	} else {
+		for (i = 0; i < enabled->len; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (enabled, i);
+
+			breakpoint->enabled = TRUE;
+		}
+	}
+
+	g_ptr_array_free (enabled, TRUE);
+	g_free (addresses);
+	g_free (sizes);
+	g_free (data);
+	g_free (read_ok);
+}
+
+/*
+ * Batched version of server_ptrace_insert_breakpoint(): we only take the breakpoint
+ * manager's lock once and enable all the new breakpoints together, sorted by address
+ * so the writes are grouped by page.
+ */
+static ServerCommandError
+server_ptrace_insert_breakpoints (ServerHandle *handle, guint32 count, const guint64 *addresses,
+				  guint32 *bhandles)
+{
+	GPtrArray *new_bpts, *failed;
+	guint32 i, j;
+
+	new_bpts = g_ptr_array_new ();
+	failed = g_ptr_array_new ();
+
+	mono_debugger_breakpoint_manager_lock ();
+
+	for (i = 0; i < count; i++) {
+		BreakpointInfo *breakpoint;
+
+		breakpoint = (BreakpointInfo *) mono_debugger_breakpoint_manager_lookup (
+			handle->bpm, addresses [i]);
+		if (breakpoint) {
+			breakpoint->refcount++;
+			bhandles [i] = breakpoint->id;
+			continue;
+		}
+
+		breakpoint = g_new0 (BreakpointInfo, 1);
+
+		breakpoint->refcount = 1;
+		breakpoint->address = addresses [i];
+		breakpoint->is_hardware_bpt = FALSE;
+		breakpoint->id = mono_debugger_breakpoint_manager_get_next_id ();
+		breakpoint->dr_index = -1;
+
+		/*
+		 * Insert it right away, so we find it if the same address is in the list
+		 * twice; it won't be enabled until we're done.
+		 */
+		mono_debugger_breakpoint_manager_insert (handle->bpm, breakpoint);
+		g_ptr_array_add (new_bpts, breakpoint);
+		bhandles [i] = breakpoint->id;
+	}
+
+	if (new_bpts->len > 0) {
+		g_ptr_array_sort (new_bpts, compare_breakpoint_address);
+		enable_breakpoints (handle, new_bpts, failed);
+	}
+
+	for (i = 0; i < failed->len; i++) {
+		BreakpointInfo *breakpoint = g_ptr_array_index (failed, i);
+
+		for (j = 0; j < count; j++) {
+			if (bhandles [j] == breakpoint->id)
+				bhandles [j] = 0;
+		}
+
+		breakpoint->refcount = 1;
+		mono_debugger_breakpoint_manager_remove (handle->bpm, breakpoint);
+	}
+
+	mono_debugger_breakpoint_manager_unlock ();
+
+	g_ptr_array_free (new_bpts, TRUE);
+	g_ptr_array_free (failed, TRUE);
+
+	return COMMAND_ERROR_NONE;
+}
+
+/*
+ * Batched version of server_ptrace_remove_breakpoint(); the original instructions of
+ * all the software breakpoints are restored with one vectored write.
+ */
+static ServerCommandError
+server_ptrace_remove_breakpoints (ServerHandle *handle, guint32 count, const guint32 *bhandles)
+{
+	ServerCommandError result = COMMAND_ERROR_NONE, ret;
+	GPtrArray *removed;
+	guint64 *addresses;
+	guint32 *sizes;
+	guint8 *data;
+	guint32 i;
+
+	removed = g_ptr_array_new ();
+
+	mono_debugger_breakpoint_manager_lock ();
+
+	for (i = 0; i < count; i++) {
+		BreakpointManager *bpm;
+		BreakpointInfo *breakpoint;
+
+		breakpoint = lookup_breakpoint (handle, bhandles [i], &bpm);
+		if (!breakpoint) {
+			if (result == COMMAND_ERROR_NONE)
+				result = COMMAND_ERROR_NO_SUCH_BREAKPOINT;
+			continue;
+		}
+
+		if (--breakpoint->refcount > 0)
+			continue;
+
+		if ((bpm == handle->bpm) && (breakpoint->dr_index < 0) && breakpoint->enabled) {
+			g_ptr_array_add (removed, breakpoint);
+			continue;
+		}
+
+		ret = x86_arch_disable_breakpoint (handle, breakpoint);
+		if (ret != COMMAND_ERROR_NONE) {
+			if (result == COMMAND_ERROR_NONE)
+				result = ret;
+			continue;
+		}
+
+		breakpoint->enabled = FALSE;
+		mono_debugger_breakpoint_manager_remove (bpm, breakpoint);
+	}
+
+	g_ptr_array_sort (removed, compare_breakpoint_address);
+
+	addresses = g_new0 (guint64, removed->len + 1);
+	sizes = g_new0 (guint32, removed->len + 1);
+	data = g_new0 (guint8, removed->len + 1);
+
+	for (i = 0; i < removed->len; i++) {
+		BreakpointInfo *breakpoint = g_ptr_array_index (removed, i);
+
+		addresses [i] = breakpoint->address;
+		sizes [i] = 1;
+		data [i] = breakpoint->saved_insn;
+	}
+
+	if (write_memory_vector (handle, removed->len, addresses, sizes, data) != COMMAND_ERROR_NONE) {
+		/* Find the breakpoints we couldn't remove. */
+		for (i = 0; i < removed->len; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (removed, i);
+
+			ret = x86_arch_disable_breakpoint (handle, breakpoint);
+			if (ret != COMMAND_ERROR_NONE) {
+				if (result == COMMAND_ERROR_NONE)
+					result = ret;
+				continue;
+			}
+
+			breakpoint->enabled = FALSE;
+			mono_debugger_breakpoint_manager_remove (handle->bpm, breakpoint);
+		}
+	} else {
+		for (i = 0; i < removed->len; i++) {
+			BreakpointInfo *breakpoint = g_ptr_array_index (removed, i);
+
+			if (handle->mono_runtime) {
+				ret = runtime_info_disable_breakpoint (handle, breakpoint);
+				if ((ret != COMMAND_ERROR_NONE) && (result == COMMAND_ERROR_NONE))
+					result = ret;
+			}
+
+			breakpoint->enabled = FALSE;
+			mono_debugger_breakpoint_manager_remove (handle->bpm, breakpoint);
+		}
+	}
+
+	mono_debugger_breakpoint_manager_unlock ();
+
+	g_ptr_array_free (removed, TRUE);
+	g_free (addresses);
+	g_free (sizes);
+	g_free (data);
+
+	return result;
+}
+
+/*
+ * We already have the registers of each stopped thread in its ArchInfo, so this
+ * doesn't need any syscalls except for reading the stacks.
+ */
+static void
+server_ptrace_get_registers_multiple (guint32 count, ServerHandle **handles,
+				      guint32 num_registers, guint64 *values,
+				      guint32 stack_size, guint8 *stack, guint32 *results)
+{
+	guint32 i;
+
+	if (num_registers < DEBUGGER_REG_LAST) {
+		for (i = 0; i < count; i++)
+			results [i] = COMMAND_ERROR_INTERNAL_ERROR;
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		guint64 *regs = values + i * num_registers;
+
+		results [i] = server_ptrace_get_registers (handles [i], regs);
+		if ((results [i] != COMMAND_ERROR_NONE) || !stack_size)
+			continue;
+
+		if (server_ptrace_read_memory (handles [i], regs [DEBUGGER_REG_RSP], stack_size,
+					       stack + i * stack_size) != COMMAND_ERROR_NONE)
+			memset (stack + i * stack_size, 0, stack_size);
+	}
+}
+
 InferiorVTable i386_ptrace_inferior = {
 	server_ptrace_global_init,
 	server_ptrace_get_server_type,
@@ -611,40 +1248,66 @@ InferiorVTable i386_ptrace_inferior = {
 	server_ptrace_detach,
 	server_ptrace_finalize,
 	server_ptrace_global_wait,
+#ifdef __linux__
+	server_ptrace_global_poll,
+#else
+	NULL,
+#endif
 	server_ptrace_stop_and_wait,
+#ifdef __linux__
+	server_ptrace_stop_all,
+#else
+	NULL,
+#endif
 	server_ptrace_dispatch_event,
 	server_ptrace_dispatch_simple,
 	server_ptrace_get_target_info,
 	server_ptrace_continue,
 	server_ptrace_step,
+#ifdef __linux__
+	server_ptrace_step_range,
+#else
+	NULL,
+#endif
 	server_ptrace_resume,
 	server_ptrace_get_frame,
 	server_ptrace_current_insn_is_bpt,
 	server_ptrace_peek_word,
 	server_ptrace_read_memory,
 	server_ptrace_write_memory,
+#ifdef __linux__
+	server_ptrace_read_memory_vector,
+#else
+	NULL,
+#endif
 	server_ptrace_call_method,
 	server_ptrace_call_method_1,
 	server_ptrace_call_method_2,
 	server_ptrace_call_method_3,
 	server_ptrace_call_method_invoke,
 	server_ptrace_execute_instruction,
+	server_ptrace_execute_displaced_instruction,
 	server_ptrace_mark_rti_frame,
 	server_ptrace_abort_invoke,
 	server_ptrace_insert_breakpoint,
 	server_ptrace_insert_hw_breakpoint,
 	server_ptrace_remove_breakpoint,
+	server_ptrace_insert_breakpoints,
+	server_ptrace_remove_breakpoints,
 	server_ptrace_enable_breakpoint,
 	server_ptrace_disable_breakpoint,
+	server_ptrace_set_breakpoint_condition,
 	server_ptrace_get_breakpoints,
 	server_ptrace_get_registers,
 	server_ptrace_set_registers,
+	server_ptrace_get_registers_multiple,
 	server_ptrace_stop,
 	server_ptrace_set_signal,
 	server_ptrace_get_pending_signal,
 	server_ptrace_kill,
 	server_ptrace_get_signal_info,
 	server_ptrace_get_threads,
+	server_ptrace_get_thread_count,
 	server_ptrace_get_application,
 	server_ptrace_detach_after_fork,
 	server_ptrace_push_registers,
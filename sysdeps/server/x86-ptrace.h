@@ -108,4 +108,20 @@ server_ptrace_get_signal_info (ServerHandle *handle, SignalInfo **sinfo);
 static gboolean
 _server_ptrace_wait_for_new_thread (ServerHandle *handle);
 
+static ServerCommandError
+server_ptrace_execute_instruction (ServerHandle *handle, const guint8 *instruction,
+				   guint32 size, gboolean update_ip);
+
+static ServerCommandError
+server_ptrace_execute_displaced_instruction (ServerHandle *handle, const guint8 *instruction,
+					     guint32 size, guint32 disp_offset);
+
+static gboolean
+_server_ptrace_check_breakpoint_condition (ServerHandle *handle, guint32 idx);
+
+#ifdef __linux__
+static ChildStoppedAction
+_server_ptrace_skip_breakpoint (ServerHandle *handle, guint32 idx);
+#endif
+
 #endif
@@ -1272,15 +1272,16 @@ x86_arch_remove_breakpoints_from_target_memory (ServerHandle *handle, guint64 st
 
 	mono_debugger_breakpoint_manager_lock ();
 
-	breakpoints = mono_debugger_breakpoint_manager_get_breakpoints (handle->bpm);
-	for (i = 0; i < breakpoints->len; i++) {
+	breakpoints = mono_debugger_breakpoint_manager_get_sorted_breakpoints (handle->bpm);
+	i = mono_debugger_breakpoint_manager_lower_bound (handle->bpm, start);
+	for (; i < breakpoints->len; i++) {
 		BreakpointInfo *info = g_ptr_array_index (breakpoints, i);
 		guint32 offset;
 
+		if (info->address >= start+size)
+			break;
 		if (info->is_hardware_bpt || !info->enabled)
 			continue;
-		if ( (info->address < start) || (info->address >= start+size))
-			continue;
 
 		offset = (guint32) info->address - start;
 		ptr [offset] = info->saved_insn;
@@ -2390,40 +2391,50 @@ InferiorVTable i386_windows_inferior = {
 	NULL,					 			/*detach, */
 	NULL,					 			/*finalize, */
 	server_win32_global_wait,			/*global_wait, */
+	NULL,					 			/*global_poll, */
 	NULL,					 			/*stop_and_wait, */
+	NULL,					 			/*stop_all, */
 	server_win32_dispatch_event,		/*dispatch_event, */
 	server_win32_dispatch_simple,								/*dispatch_simple, */
 	server_win32_get_target_info,		/*get_target_info, */
 	NULL,					 			/*continue, */
 	NULL,					 			/*step, */
+	NULL,					 			/*step_range, */
 	NULL,					 			/*resume, */
 	server_win32_get_frame,	 			/*get_frame, */
 	NULL,					 			/*current_insn_is_bpt, */
 	NULL,					 			/*peek_word, */
 	server_win32_read_memory,			/*read_memory, */
 	server_win32_write_memory,		/*write_memory, */
+	NULL,					 			/*read_memory_vector, */
 	NULL,					 			/*call_method, */
 	NULL,					 			/*call_method_1, */
 	NULL,					 			/*call_method_2, */
 	NULL,					 			/*call_method_3, */
 	NULL,					 			/*call_method_invoke, */
 	NULL,					 			/*execute_instruction, */
+	NULL,					 			/*execute_displaced_instruction, */
 	NULL,					 			/*mark_rti_frame, */
 	NULL,					 			/*abort_invoke, */
 	server_win32_insert_breakpoint,					 			/*insert_breakpoint, */
 	NULL,					 			/*insert_hw_breakpoint, */
 	server_win32_remove_breakpoint,					 			/*remove_breakpoint, */
+	NULL,					 			/*insert_breakpoints, */
+	NULL,					 			/*remove_breakpoints, */
 	NULL,					 			/*enable_breakpoint, */
 	NULL,					 			/*disable_breakpoint, */
+	NULL,					 			/*set_breakpoint_condition, */
 	server_win32_get_breakpoints,		/*get_breakpoints, */
 	server_win32_get_registers,					 			/*get_registers, */
 	server_win32_set_registers,					 			/*set_registers, */
+	NULL,					 			/*get_registers_multiple, */
 	NULL,					 			/*stop, */
 	NULL,					 			/*set_signal, */
 	NULL,					 			/*server_ptrace_get_pending_signal, */
 	NULL,					 			/*kill, */
 	server_win32_get_signal_info,					 			/*get_signal_info, */
 	NULL,					 			/*get_threads, */
+	NULL,					 			/*get_thread_count, */
 	server_win32_get_application,		/*get_application, */
 	NULL,								/*detach_after_fork, */
 	NULL,								/*push_registers, */
@@ -922,6 +922,52 @@ namespace Mono.Debugger.Test.Framework
 					     expression, text, exp_result);
 		}
 
+		// <summary>
+		//   Like AssertPrint(), but evaluates the expression the way a display
+		//   does, so the resolved expression is looked up in and added to the
+		//   interpreter's expression cache.
+		// </summary>
+		public void AssertDisplay (Thread thread, string expression, string exp_result)
+		{
+			string text = null;
+			try {
+				ScriptingContext context = GetContext (thread);
+
+				text = interpreter.ExpressionParser.EvaluateExpression (
+					context, expression, DisplayFormat.Object);
+			} catch (AssertionException) {
+				throw;
+			} catch (Exception ex) {
+				Assert.Fail ("Failed to display expression `{0}': {1}",
+					     expression, ex);
+			}
+
+			if (text != exp_result)
+				Assert.Fail ("Expression `{0}' evaluated to `{1}', but expected `{2}'.",
+					     expression, text, exp_result);
+		}
+
+		// <summary>
+		//   Sets the condition of breakpoint @index; the breakpoint is
+		//   reinserted, so the server gets the new condition.
+		// </summary>
+		public Breakpoint SetCondition (Thread thread, int index,
+						BreakpointCondition condition)
+		{
+			Breakpoint bpt = (Breakpoint) Interpreter.Session.GetEvent (index);
+			bpt.Deactivate (thread);
+			bpt.Condition = condition;
+			bpt.Activate (thread);
+			return bpt;
+		}
+
+		public Breakpoint AssertConditionalBreakpoint (Thread thread, string line,
+							       BreakpointCondition condition)
+		{
+			int index = AssertBreakpoint (GetLine (line));
+			return SetCondition (thread, index, condition);
+		}
+
 		public void AssertType (Thread thread, string expression, string exp_result)
 		{
 			string text = null;
@@ -0,0 +1,163 @@
+/*
+ * Benchmark for removing the software breakpoints from a buffer which has just been read
+ * from the target - what x86_arch_remove_breakpoints_from_target_memory() does on each
+ * memory read:
+ *
+ *   linear - walk all the breakpoints and check each of them against the range (what the
+ *            server used to do)
+ *   sorted - binary-search the address-sorted array to the first breakpoint inside the
+ *            range and stop at its end
+ *
+ * The breakpoints are inserted into a real BreakpointManager, spread over a 64 MB text
+ * segment.  Build with `make read-memory-bench' and run it without arguments.
+ */
+
+#include <server.h>
+#include <breakpoints.h>
+#include <sys/time.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define TEXT_START	0x400000
+#define TEXT_SIZE	(64 * 1024 * 1024)
+#define MAX_SIZE	65536
+#define TOTAL_READS	20000
+
+static void
+remove_linear (BreakpointManager *bpm, guint64 start, guint32 size, guint8 *ptr)
+{
+	GPtrArray *breakpoints;
+	int i;
+
+	mono_debugger_breakpoint_manager_lock ();
+
+	breakpoints = mono_debugger_breakpoint_manager_get_breakpoints (bpm);
+	for (i = 0; i < breakpoints->len; i++) {
+		BreakpointInfo *info = g_ptr_array_index (breakpoints, i);
+
+		if (info->is_hardware_bpt || !info->enabled)
+			continue;
+		if ((info->address < start) || (info->address >= start+size))
+			continue;
+
+		ptr [info->address - start] = info->saved_insn;
+	}
+
+	mono_debugger_breakpoint_manager_unlock ();
+}
+
+static void
+remove_sorted (BreakpointManager *bpm, guint64 start, guint32 size, guint8 *ptr)
+{
+	GPtrArray *breakpoints;
+	int i;
+
+	mono_debugger_breakpoint_manager_lock ();
+
+	breakpoints = mono_debugger_breakpoint_manager_get_sorted_breakpoints (bpm);
+	i = mono_debugger_breakpoint_manager_lower_bound (bpm, start);
+	for (; i < breakpoints->len; i++) {
+		BreakpointInfo *info = g_ptr_array_index (breakpoints, i);
+
+		if (info->address >= start+size)
+			break;
+		if (info->is_hardware_bpt || !info->enabled)
+			continue;
+
+		ptr [info->address - start] = info->saved_insn;
+	}
+
+	mono_debugger_breakpoint_manager_unlock ();
+}
+
+typedef void (*RemoveFunc) (BreakpointManager *, guint64, guint32, guint8 *);
+
+static double
+now (void)
+{
+	struct timeval tv;
+
+	gettimeofday (&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static void
+run (const char *name, RemoveFunc func, BreakpointManager *bpm, guint64 *starts,
+     guint32 size, guint8 *buffer)
+{
+	double start, elapsed;
+	int i;
+
+	start = now ();
+	for (i = 0; i < TOTAL_READS; i++)
+		func (bpm, starts [i], size, buffer);
+	elapsed = now () - start;
+
+	printf ("  %-8s %6u bytes: %10.3f us/read\n", name, size,
+		elapsed * 1000000.0 / TOTAL_READS);
+}
+
+static BreakpointManager *
+create_breakpoints (int count)
+{
+	BreakpointManager *bpm = mono_debugger_breakpoint_manager_new ();
+	int i;
+
+	for (i = 0; i < count; i++) {
+		BreakpointInfo *info = g_new0 (BreakpointInfo, 1);
+
+		info->id = mono_debugger_breakpoint_manager_get_next_id ();
+		info->refcount = 1;
+		info->enabled = TRUE;
+		info->saved_insn = 0x55;
+		info->address = TEXT_START + (guint64) random () % TEXT_SIZE;
+
+		if (mono_debugger_breakpoint_manager_lookup (bpm, info->address)) {
+			g_free (info);
+			continue;
+		}
+
+		mono_debugger_breakpoint_manager_insert (bpm, info);
+	}
+
+	return bpm;
+}
+
+int
+main (void)
+{
+	static const int counts[] = { 10, 100, 1000, 10000, 20000 };
+	static const guint32 sizes[] = { 8, 64, 4096, MAX_SIZE };
+	guint8 *buffer;
+	guint64 *starts;
+	unsigned i, j;
+
+	buffer = g_malloc0 (MAX_SIZE);
+	starts = g_new0 (guint64, TOTAL_READS);
+
+	srandom (42);
+
+	for (i = 0; i < sizeof (counts) / sizeof (counts [0]); i++) {
+		BreakpointManager *bpm = create_breakpoints (counts [i]);
+
+		printf ("%d breakpoints:\n", counts [i]);
+		for (j = 0; j < sizeof (sizes) / sizeof (sizes [0]); j++) {
+			int k;
+
+			for (k = 0; k < TOTAL_READS; k++)
+				starts [k] = TEXT_START + (guint64) random () % (TEXT_SIZE - sizes [j]);
+
+			run ("linear", remove_linear, bpm, starts, sizes [j], buffer);
+			run ("sorted", remove_sorted, bpm, starts, sizes [j], buffer);
+		}
+
+		for (j = 0; j < bpm->breakpoints->len; j++)
+			g_free (g_ptr_array_index (bpm->breakpoints, j));
+		mono_debugger_breakpoint_manager_free (bpm);
+	}
+
+	g_free (starts);
+	g_free (buffer);
+	return 0;
+}
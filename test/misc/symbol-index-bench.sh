@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+# Cold-vs-warm startup benchmark for the SymbolIndexCache in backend/os/SymbolIndexCache.cs.
+#
+# Starts PROGRAM under mdb, stops in Main() and exits again, ITERATIONS times each:
+#
+#   cold - with an empty cache directory, so all the BFD symbol tables, .debug_aranges
+#          and .debug_pubnames are parsed and then written to the cache
+#   warm - with the cache from the previous run, so they're read from the cache
+#   off  - with the cache disabled
+#
+# Usage: symbol-index-bench.sh [PROGRAM [ITERATIONS]]
+#
+# Set MDB to the mdb script to use; it defaults to the one in the build tree.
+#
+
+MDB=${MDB:-`dirname $0`/../../build/mdb}
+PROGRAM=${1:-`dirname $0`/../src/TestBreakpoint.exe}
+ITERATIONS=${2:-5}
+
+CACHE_DIR=`mktemp -d ${TMPDIR:-/tmp}/symbol-index-bench.XXXXXX` || exit 1
+trap 'rm -rf $CACHE_DIR' 0
+
+now ()
+{
+	date +%s.%N
+}
+
+run_mdb ()
+{
+	printf 'kill\nquit\n' | MDB_SYMBOL_INDEX_CACHE=$1 $MDB -script -run $PROGRAM > /dev/null 2>&1
+}
+
+run ()
+{
+	name=$1
+	total=0
+
+	for i in `seq $ITERATIONS`; do
+		if [ $name = cold ]; then
+			rm -rf $CACHE_DIR/*
+		fi
+
+		if [ $name = off ]; then
+			cache=off
+		else
+			cache=$CACHE_DIR
+		fi
+
+		start=`now`
+		run_mdb $cache
+		end=`now`
+		total=`echo "$total + $end - $start" | bc`
+	done
+
+	printf '  %-5s %8.3f s/startup\n' $name `echo "scale=3; $total / $ITERATIONS" | bc`
+}
+
+if [ ! -x "$MDB" ] || [ ! -f "$PROGRAM" ]; then
+	echo "Usage: $0 [PROGRAM [ITERATIONS]]; set MDB to the mdb script" >&2
+	exit 1
+fi
+
+echo "$PROGRAM, $ITERATIONS iterations:"
+run off
+run cold
+run warm
+echo "  cache: `du -sh $CACHE_DIR | cut -f1` in `ls $CACHE_DIR | wc -l` entries"
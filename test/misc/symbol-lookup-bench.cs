@@ -0,0 +1,157 @@
+//
+// Benchmark for BfdSymbolTable.SimpleLookup() in backend/os/Bfd.cs, which finds the
+// symbol containing an address in a native library's symbol table:
+//
+//   linear - scan the sorted table backwards from the end (what SimpleLookup() used to do)
+//   binary - binary-search the nearest preceding symbol (what it does now)
+//
+// Both lookups are copies of the code in Bfd.cs, run over synthetic tables of the size of
+// libc's or libmono's.  Build with `make symbol-lookup-bench.exe' and run it with mono.
+//
+
+using System;
+using System.Diagnostics;
+
+class SymbolLookupBench
+{
+	struct SymbolEntry
+	{
+		public readonly long Address;
+		public readonly string Name;
+
+		public SymbolEntry (long address, string name)
+		{
+			this.Address = address;
+			this.Name = name;
+		}
+	}
+
+	const long TextStart = 0x400000;
+	const int Lookups = 20000;
+
+	static SymbolEntry[] CreateTable (Random random, int count)
+	{
+		long[] addresses = new long [count];
+		long address = TextStart;
+		for (int i = 0; i < count; i++) {
+			addresses [i] = address;
+			// Aliases: about one symbol in 20 shares its address with the next one.
+			if (random.Next (20) != 0)
+				address += 16 + random.Next (512);
+		}
+
+		SymbolEntry[] list = new SymbolEntry [count];
+		for (int i = 0; i < count; i++)
+			list [i] = new SymbolEntry (addresses [i], "symbol" + i);
+		return list;
+	}
+
+	static string LinearLookup (SymbolEntry[] list, long address, bool exact_match)
+	{
+		for (int i = list.Length - 1; i >= 0; i--) {
+			SymbolEntry entry = list [i];
+
+			if (address < entry.Address)
+				continue;
+
+			long offset = address - entry.Address;
+			if (offset == 0) {
+				while (i > 0) {
+					SymbolEntry n_entry = list [--i];
+
+					if (n_entry.Address == entry.Address)
+						entry = n_entry;
+					else
+						break;
+				}
+
+				return entry.Name;
+			} else if (exact_match)
+				return null;
+			else
+				return entry.Name;
+		}
+
+		return null;
+	}
+
+	static int UpperBound (SymbolEntry[] list, long address)
+	{
+		int lo = 0, hi = list.Length;
+
+		while (lo < hi) {
+			int mid = lo + (hi - lo) / 2;
+			if (list [mid].Address <= address)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		return lo;
+	}
+
+	static string BinaryLookup (SymbolEntry[] list, long address, bool exact_match)
+	{
+		int i = UpperBound (list, address) - 1;
+		if (i < 0)
+			return null;
+
+		SymbolEntry entry = list [i];
+		if (entry.Address == address) {
+			while ((i > 0) && (list [i - 1].Address == address))
+				entry = list [--i];
+			return entry.Name;
+		} else if (exact_match)
+			return null;
+		else
+			return entry.Name;
+	}
+
+	delegate string LookupFunc (SymbolEntry[] list, long address, bool exact_match);
+
+	static void Run (string name, LookupFunc func, SymbolEntry[] list, long[] addresses,
+			 bool exact_match)
+	{
+		Stopwatch watch = Stopwatch.StartNew ();
+		for (int i = 0; i < addresses.Length; i++)
+			func (list, addresses [i], exact_match);
+		watch.Stop ();
+
+		Console.WriteLine ("  {0,-8} {1,-9} {2,10:0.000} us/lookup", name,
+				   exact_match ? "exact" : "nearest",
+				   watch.Elapsed.TotalMilliseconds * 1000.0 / addresses.Length);
+	}
+
+	static void Main ()
+	{
+		int[] counts = { 1000, 10000, 50000, 200000 };
+		Random random = new Random (42);
+
+		foreach (int count in counts) {
+			SymbolEntry[] list = CreateTable (random, count);
+			long end = list [list.Length - 1].Address + 512;
+
+			long[] addresses = new long [Lookups];
+			long[] exact = new long [Lookups];
+			for (int i = 0; i < Lookups; i++) {
+				addresses [i] = TextStart + (long) (random.NextDouble () * (end - TextStart));
+				exact [i] = list [random.Next (count)].Address;
+			}
+
+			for (int i = 0; i < Lookups; i++) {
+				if (LinearLookup (list, addresses [i], false) !=
+				    BinaryLookup (list, addresses [i], false))
+					throw new Exception ("Lookups disagree at " + addresses [i]);
+				if (LinearLookup (list, exact [i], true) !=
+				    BinaryLookup (list, exact [i], true))
+					throw new Exception ("Lookups disagree at " + exact [i]);
+			}
+
+			Console.WriteLine ("{0} symbols:", count);
+			Run ("linear", LinearLookup, list, addresses, false);
+			Run ("binary", BinaryLookup, list, addresses, false);
+			Run ("linear", LinearLookup, list, exact, true);
+			Run ("binary", BinaryLookup, list, exact, true);
+		}
+	}
+}
@@ -0,0 +1,175 @@
+/*
+ * Throughput benchmark for the different ways of writing to a traced child's memory:
+ *
+ *   ptrace    - one PT_WRITE_D per word (what server_ptrace_write_memory() used to do)
+ *   procmem   - a single pwrite64() on /proc/<pid>/mem
+ *   vm_writev - a single process_vm_writev()
+ *
+ * Build with `make write-memory-bench' and run it without arguments.
+ */
+
+#define _GNU_SOURCE
+#include <sys/types.h>
+#include <sys/ptrace.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/uio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#define MAX_SIZE	(4 * 1024 * 1024)
+#define TOTAL_BYTES	(64 * 1024 * 1024)
+
+static int
+write_ptrace (pid_t pid, int mem_fd, unsigned long addr, const char *buffer, size_t size)
+{
+	long word;
+
+	while (size >= sizeof (long)) {
+		memcpy (&word, buffer, sizeof (long));
+
+		errno = 0;
+		if (ptrace (PTRACE_POKEDATA, pid, (void *) addr, (void *) word) != 0)
+			return -1;
+
+		buffer += sizeof (long);
+		addr += sizeof (long);
+		size -= sizeof (long);
+	}
+
+	return 0;
+}
+
+static int
+write_procmem (pid_t pid, int mem_fd, unsigned long addr, const char *buffer, size_t size)
+{
+	while (size) {
+		ssize_t ret = pwrite64 (mem_fd, buffer, size, addr);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			return -1;
+		} else if (!ret)
+			return -1;
+
+		buffer += ret;
+		addr += ret;
+		size -= ret;
+	}
+
+	return 0;
+}
+
+static int
+write_vm_writev (pid_t pid, int mem_fd, unsigned long addr, const char *buffer, size_t size)
+{
+	struct iovec local, remote;
+	ssize_t ret;
+
+	local.iov_base = (void *) buffer;
+	local.iov_len = size;
+	remote.iov_base = (void *) addr;
+	remote.iov_len = size;
+
+	ret = process_vm_writev (pid, &local, 1, &remote, 1, 0);
+	return ret == (ssize_t) size ? 0 : -1;
+}
+
+typedef int (*WriteFunc) (pid_t, int, unsigned long, const char *, size_t);
+
+static double
+now (void)
+{
+	struct timeval tv;
+
+	gettimeofday (&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static void
+run (const char *name, WriteFunc func, pid_t pid, int mem_fd, unsigned long addr,
+     const char *buffer, size_t size)
+{
+	int iterations = TOTAL_BYTES / size;
+	double start, elapsed;
+	int i;
+
+	if (iterations > 100000)
+		iterations = 100000;
+
+	start = now ();
+	for (i = 0; i < iterations; i++) {
+		if (func (pid, mem_fd, addr, buffer, size) < 0) {
+			printf ("  %-10s %8lu bytes: failed (%s)\n", name, (unsigned long) size,
+				strerror (errno));
+			return;
+		}
+	}
+	elapsed = now () - start;
+
+	printf ("  %-10s %8lu bytes: %10.1f MB/s  %10.2f us/write\n", name,
+		(unsigned long) size, (double) size * iterations / elapsed / (1024 * 1024),
+		elapsed * 1000000.0 / iterations);
+}
+
+int
+main (void)
+{
+	static const size_t sizes[] = { 8, 64, 512, 4096, 65536, MAX_SIZE };
+	char filename [BUFSIZ];
+	unsigned long addr;
+	char *buffer;
+	int status, mem_fd;
+	unsigned i;
+	pid_t pid;
+
+	/*
+	 * The child inherits the mapping at the same address, so we don't need to
+	 * talk to it to find out where to write.
+	 */
+	buffer = mmap (NULL, MAX_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (buffer == MAP_FAILED) {
+		perror ("mmap");
+		return 1;
+	}
+	memset (buffer, 0x90, MAX_SIZE);
+	addr = (unsigned long) buffer;
+
+	pid = fork ();
+	if (pid < 0) {
+		perror ("fork");
+		return 1;
+	} else if (!pid) {
+		ptrace (PTRACE_TRACEME, 0, NULL, NULL);
+		raise (SIGSTOP);
+		_exit (0);
+	}
+
+	if ((waitpid (pid, &status, 0) != pid) || !WIFSTOPPED (status)) {
+		fprintf (stderr, "Can't trace child.\n");
+		return 1;
+	}
+
+	snprintf (filename, BUFSIZ, "/proc/%d/mem", pid);
+	mem_fd = open (filename, O_RDWR);
+	if (mem_fd < 0)
+		fprintf (stderr, "Can't open %s for writing: %s\n", filename, strerror (errno));
+
+	for (i = 0; i < sizeof (sizes) / sizeof (sizes [0]); i++) {
+		printf ("%lu bytes:\n", (unsigned long) sizes [i]);
+		run ("ptrace", write_ptrace, pid, mem_fd, addr, buffer, sizes [i]);
+		if (mem_fd >= 0)
+			run ("procmem", write_procmem, pid, mem_fd, addr, buffer, sizes [i]);
+		run ("vm_writev", write_vm_writev, pid, mem_fd, addr, buffer, sizes [i]);
+	}
+
+	kill (pid, SIGKILL);
+	waitpid (pid, &status, 0);
+	return 0;
+}
@@ -0,0 +1,19 @@
+using System;
+
+class X
+{
+	static int Add (int a, int b)
+	{
+		return a + b;
+	}
+
+	static void Main ()
+	{
+		int sum = 0;				// @MDB LINE: main
+		for (int i = 0; i < 2; i++) {
+			sum = Add (sum, i);		// @MDB LINE: first
+			sum = Add (sum, 2 * i);		// @MDB LINE: second
+		}
+		Console.WriteLine ("Sum {0}", sum);	// @MDB LINE: third
+	}
+}
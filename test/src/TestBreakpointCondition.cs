@@ -0,0 +1,79 @@
+using System;
+using System.Threading;
+using System.Runtime.CompilerServices;
+
+class X
+{
+	static int Counter;
+
+	static void TestRegister ()
+	{
+		for (int i = 1; i <= 3; i++) {
+			Counter = i;
+			Console.WriteLine ("Register {0}", i);		// @MDB LINE: register
+		}
+	}
+
+	static void TestMemory ()
+	{
+		for (int i = 1; i <= 3; i++) {
+			Counter = i;
+			Console.WriteLine ("Memory {0}", i);		// @MDB LINE: memory
+		}
+	}
+
+	static void TestMatch ()
+	{
+		for (int i = 1; i <= 3; i++) {
+			Counter = i;
+			Console.WriteLine ("Match {0}", i);		// @MDB LINE: match
+		}
+	}
+
+	static void TestIgnore ()
+	{
+		for (int i = 1; i <= 3; i++) {
+			Counter = i;
+			Console.WriteLine ("Ignore {0}", i);		// @MDB LINE: ignore
+		}
+	}
+
+	static void Work (string name)
+	{
+		Console.WriteLine ("Work {0}", name);			// @MDB LINE: work
+	}
+
+	static void TestThread ()
+	{
+		Thread thread = new Thread (delegate () {
+			Work ("child");
+		});
+		thread.Start ();
+		thread.Join ();
+
+		Work ("main");
+	}
+
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	static void Callee ()
+	{ }
+
+	static void TestCall ()
+	{
+		for (int i = 1; i <= 3; i++) {
+			Counter = i;
+			Callee ();					// @MDB LINE: call
+			Console.WriteLine ("Call {0}", i);
+		}
+	}
+
+	static void Main ()
+	{
+		TestRegister ();					// @MDB LINE: main
+		TestMemory ();
+		TestMatch ();
+		TestIgnore ();
+		TestThread ();
+		TestCall ();
+	}
+}
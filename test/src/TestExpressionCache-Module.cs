@@ -0,0 +1,11 @@
+using System;
+
+public class Helper
+{
+	public static int Count;
+
+	public int Run ()
+	{
+		return ++Count;
+	}
+}
@@ -0,0 +1,57 @@
+using System;
+using System.Runtime.CompilerServices;
+
+class Foo
+{
+	public int Value = 3;
+}
+
+class Bar
+{
+	public string Value = "Bar";
+}
+
+class X
+{
+	static void TestScope ()
+	{
+		{
+			int value = 3;
+			Console.WriteLine ("Scope {0}", value);		// @MDB BREAKPOINT: scope1
+		}
+		{
+			string value = "Hello";
+			Console.WriteLine ("Scope {0}", value);		// @MDB BREAKPOINT: scope2
+		}
+	}
+
+	static void TestType ()
+	{
+		object obj = new Foo ();
+		Console.WriteLine ("Type {0}", obj);			// @MDB BREAKPOINT: type1
+		obj = new Bar ();
+		Console.WriteLine ("Type {0}", obj);			// @MDB BREAKPOINT: type2
+	}
+
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	static int Run ()
+	{
+		Helper helper = new Helper ();
+		return helper.Run ();
+	}
+
+	static void TestModule ()
+	{
+		int count = 0;
+		Console.WriteLine ("Module {0}", count);		// @MDB BREAKPOINT: module1
+		count = Run ();
+		Console.WriteLine ("Module {0}", count);		// @MDB BREAKPOINT: module2
+	}
+
+	static void Main ()
+	{
+		TestScope ();						// @MDB LINE: main
+		TestType ();
+		TestModule ();
+	}
+}
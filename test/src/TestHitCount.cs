@@ -0,0 +1,38 @@
+using System;
+using System.Runtime.CompilerServices;
+
+class X
+{
+	static int Counter;
+
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	static void Probe ()
+	{
+		Counter++;						// @MDB LINE: probe
+	}
+
+	static void TestProbe ()
+	{
+		for (int i = 0; i < 25; i++)
+			Probe ();
+	}
+
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	static void Sample (int i)
+	{
+		Counter += i;						// @MDB LINE: sample
+	}
+
+	static void TestSample ()
+	{
+		for (int i = 1; i <= 25; i++)
+			Sample (i);
+	}
+
+	static void Main ()
+	{
+		TestProbe ();						// @MDB LINE: main
+		TestSample ();
+		Console.WriteLine ("Done");
+	}
+}
@@ -0,0 +1,37 @@
+using System;
+using System.Threading;
+
+class X
+{
+	public const int NumThreads = 256;
+
+	static ManualResetEvent start_event = new ManualResetEvent (false);
+	static int hits;
+
+	static void Hit ()
+	{
+		Interlocked.Increment (ref hits);		// @MDB BREAKPOINT: hit
+	}
+
+	static void ThreadMain ()
+	{
+		start_event.WaitOne ();
+		Hit ();
+	}
+
+	static void Main ()
+	{
+		Thread[] threads = new Thread [NumThreads];	// @MDB LINE: main
+		for (int i = 0; i < NumThreads; i++) {
+			threads [i] = new Thread (ThreadMain);
+			threads [i].Start ();
+		}
+
+		start_event.Set ();
+
+		foreach (Thread thread in threads)
+			thread.Join ();
+
+		Console.WriteLine ("Hits: {0}", hits);
+	}
+}
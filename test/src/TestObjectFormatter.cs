@@ -0,0 +1,23 @@
+using System;
+
+class X
+{
+	static void Main ()
+	{
+		int[] big = new int [1500];
+		for (int i = 0; i < big.Length; i++)
+			big [i] = i;
+
+		string text = new String ('x', 12000);
+
+		int[,] matrix = new int [40, 40];
+		int[][] jagged = new int [40][];
+		for (int i = 0; i < 40; i++) {
+			jagged [i] = new int [40];
+			for (int j = 0; j < 40; j++)
+				matrix [i, j] = jagged [i][j] = i * 40 + j;
+		}
+
+		Console.WriteLine ("{0} {1}", big.Length, text.Length);	// @MDB BREAKPOINT: main
+	}
+}
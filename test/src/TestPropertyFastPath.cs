@@ -0,0 +1,32 @@
+using System;
+
+public class Test
+{
+	string name = "Test";
+
+	public string Name {
+		get {
+			return name;				// @MDB LINE: name
+		}
+	}
+
+	public int Answer {
+		get; set;
+	}
+
+	public string Greeting {
+		get {
+			return "Hello " + name;			// @MDB LINE: greeting
+		}
+	}
+}
+
+class X
+{
+	static void Main ()
+	{
+		Test test = new Test ();			// @MDB LINE: main
+		test.Answer = 42;
+		Console.WriteLine (test.Greeting);		// @MDB BREAKPOINT: print
+	}
+}
@@ -0,0 +1,23 @@
+using System;
+using System.Runtime.CompilerServices;
+
+class X
+{
+	//
+	// On x86_64, the JIT loads floating point constants with a RIP-relative
+	// operand, so the test can put a breakpoint on such an instruction.
+	//
+	[MethodImpl(MethodImplOptions.NoInlining)]
+	static double Scale (double value)
+	{
+		return value * 2.5;					// @MDB LINE: scale
+	}
+
+	static void Main ()
+	{
+		double a = Scale (4.0);					// @MDB LINE: main
+		Console.WriteLine ("Scale {0}", a);
+		double b = Scale (6.0);
+		Console.WriteLine ("Scale {0}", b);
+	}
+}
@@ -0,0 +1,72 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestBatchedBreakpoints : DebuggerTestFixture
+	{
+		public TestBatchedBreakpoints ()
+			: base ("TestBatchedBreakpoints")
+		{ }
+
+		[Test]
+		[Category("GUI")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			//
+			// These are only activated by the next `break -gui', so all three
+			// breakpoints are inserted together; the first two have the same
+			// address.
+			//
+			string first = GetLine ("first").ToString ();
+			Event bpt_first = Interpreter.Session.InsertBreakpoint (
+				ThreadGroup.Global, LocationType.Default, first);
+			Event bpt_same = Interpreter.Session.InsertBreakpoint (
+				ThreadGroup.Global, LocationType.Default, first);
+
+			int bpt_second = (int) AssertExecute ("break -gui " + GetLine ("second"));
+
+			Assert.IsTrue (bpt_first.IsActivated);
+			Assert.IsTrue (bpt_same.IsActivated);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, -1, "X.Main()", GetLine ("first"));
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_second, "X.Main()", GetLine ("second"));
+
+			//
+			// Remove all of them and insert a new one in the same batch.
+			//
+			Interpreter.Session.DeactivateEventAsync (bpt_first);
+			Interpreter.Session.DeactivateEventAsync (bpt_same);
+			Interpreter.Session.DeactivateEventAsync (
+				Interpreter.Session.GetEvent (bpt_second));
+
+			int bpt_third = (int) AssertExecute ("break -gui " + GetLine ("third"));
+
+			Assert.IsFalse (bpt_first.IsActivated);
+			Assert.IsFalse (bpt_same.IsActivated);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_third, "X.Main()", GetLine ("third"));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Sum 3");
+			AssertTargetExited (process);
+		}
+	}
+}
@@ -0,0 +1,155 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestBreakpointCondition : DebuggerTestFixture
+	{
+		public TestBreakpointCondition ()
+			: base ("TestBreakpointCondition")
+		{ }
+
+		public override void SetUp ()
+		{
+			base.SetUp ();
+			Interpreter.IgnoreThreadCreation = true;
+		}
+
+		[Test]
+		[Category("Breakpoints")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			Register sp = thread.GetRegisters () ["rsp"];
+			if (sp == null)
+				sp = thread.GetRegisters () ["esp"];
+			Assert.IsNotNull (sp);
+
+			TargetObject counter = (TargetObject) EvaluateExpression (thread, "X.Counter");
+			Assert.IsTrue (counter.HasAddress);
+			long address = counter.GetAddress (thread).Address;
+
+			//
+			// Conditions which are never true never stop the target.
+			//
+
+			AssertConditionalBreakpoint (
+				thread, "register", BreakpointCondition.CompareRegister (
+					sp.Index, BreakpointConditionOperator.Equal, 0));
+
+			AssertExecute ("next");
+			AssertTargetOutput ("Register 1");
+			AssertTargetOutput ("Register 2");
+			AssertTargetOutput ("Register 3");
+			AssertStopped (thread, "main+1", "X.Main()");
+
+			AssertConditionalBreakpoint (
+				thread, "memory", BreakpointCondition.CompareMemory (
+					-1, address, 4, BreakpointConditionOperator.Equal, 100));
+
+			AssertExecute ("next");
+			AssertTargetOutput ("Memory 1");
+			AssertTargetOutput ("Memory 2");
+			AssertTargetOutput ("Memory 3");
+			AssertStopped (thread, "main+2", "X.Main()");
+
+			//
+			// Stop when `Counter' is 2.
+			//
+
+			int bpt_match = AssertConditionalBreakpoint (
+				thread, "match", BreakpointCondition.CompareMemory (
+					-1, address, 4, BreakpointConditionOperator.Equal, 2)).Index;
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Match 1");
+			AssertHitBreakpoint (thread, bpt_match, "X.TestMatch()", GetLine ("match"));
+			AssertPrint (thread, "i", "(int) 2");
+
+			//
+			// A condition which is always true, but with an ignore count.
+			//
+
+			BreakpointCondition ignore = BreakpointCondition.CompareRegister (
+				sp.Index, BreakpointConditionOperator.NotEqual, 0);
+			ignore.IgnoreCount = 2;
+			int bpt_ignore = AssertConditionalBreakpoint (thread, "ignore", ignore).Index;
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Match 2");
+			AssertTargetOutput ("Match 3");
+			AssertTargetOutput ("Ignore 1");
+			AssertTargetOutput ("Ignore 2");
+			AssertHitBreakpoint (thread, bpt_ignore, "X.TestIgnore()", GetLine ("ignore"));
+			AssertPrint (thread, "i", "(int) 3");
+
+			//
+			// Only break in the main thread; the child runs through Work() first.
+			//
+
+			AssertExecute ("threadgroup create main");
+			AssertExecute ("threadgroup add main " + thread.ID);
+			int bpt_work = AssertBreakpoint (
+				"-group main " + FileName + ":" + GetLine ("work"));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Ignore 3");
+			AssertTargetOutput ("Work child");
+			AssertHitBreakpoint (thread, bpt_work, "X.Work(string)", GetLine ("work"));
+			AssertPrint (thread, "name", "(string) \"main\"");
+
+			//
+			// The server can't execute a call out of line, so it reports the hit and
+			// the engine steps over the breakpoint if the condition is false.
+			//
+
+			int bpt_call_line = AssertBreakpoint (GetLine ("call"));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Work main");
+			AssertHitBreakpoint (thread, bpt_call_line, "X.TestCall()", GetLine ("call"));
+
+			TargetAddress call = TargetAddress.Null;
+			StackFrame frame = thread.CurrentFrame;
+			AssemblerMethod asm = thread.DisassembleMethod (frame.Method);
+			foreach (AssemblerLine line in asm.Lines) {
+				if (line.Address < frame.TargetAddress)
+					continue;
+				if (line.Text.TrimStart ().StartsWith ("call")) {
+					call = line.Address;
+					break;
+				}
+			}
+			Assert.IsFalse (call.IsNull, "No call instruction in X.TestCall().");
+
+			AssertExecute ("delete " + bpt_call_line);
+
+			int bpt_call = Interpreter.Session.InsertBreakpoint (
+				thread, ThreadGroup.Global, call).Index;
+			SetCondition (thread, bpt_call, BreakpointCondition.CompareMemory (
+				-1, address, 4, BreakpointConditionOperator.Equal, 3));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Call 1");
+			AssertTargetOutput ("Call 2");
+			AssertHitBreakpoint (thread, bpt_call, "X.TestCall()", GetLine ("call"));
+			AssertPrint (thread, "i", "(int) 3");
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Call 3");
+			AssertTargetExited (thread.Process);
+		}
+	}
+}
@@ -0,0 +1,79 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestExpressionCache : DebuggerTestFixture
+	{
+		public TestExpressionCache ()
+			: base ("TestExpressionCache")
+		{ }
+
+		[Test]
+		[Category("ExpressionEvaluator")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			//
+			// Same method, but `value' is a different local in the second block.
+			//
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, "scope1", "X.TestScope()");
+			AssertDisplay (thread, "value", "(int) 3");
+			AssertDisplay (thread, "value", "(int) 3");
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Scope 3");
+			AssertHitBreakpoint (thread, "scope2", "X.TestScope()");
+			AssertDisplay (thread, "value", "(string) \"Hello\"");
+
+			//
+			// The instance `obj' refers to changes its type.
+			//
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Scope Hello");
+			AssertHitBreakpoint (thread, "type1", "X.TestType()");
+			AssertDisplay (thread, "obj.Value", "(int) 3");
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Type Foo");
+			AssertHitBreakpoint (thread, "type2", "X.TestType()");
+			AssertDisplay (thread, "obj.Value", "(string) \"Bar\"");
+			AssertDisplay (thread, "obj.Value", "(string) \"Bar\"");
+
+			//
+			// TestExpressionCache-Module.dll is loaded between the two stops,
+			// which flushes the cache; the display is resolved again.
+			//
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Type Bar");
+			AssertHitBreakpoint (thread, "module1", "X.TestModule()");
+			AssertDisplay (thread, "count", "(int) 0");
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Module 0");
+			AssertHitBreakpoint (thread, "module2", "X.TestModule()");
+			AssertDisplay (thread, "count", "(int) 1");
+			AssertDisplay (thread, "Helper.Count", "(int) 1");
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Module 1");
+			AssertTargetExited (thread.Process);
+		}
+	}
+}
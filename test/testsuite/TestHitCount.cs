@@ -0,0 +1,70 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestHitCount : DebuggerTestFixture
+	{
+		public TestHitCount ()
+			: base ("TestHitCount")
+		{ }
+
+		void AssertHitCount (Process process, Breakpoint bpt, long exp_count)
+		{
+			long[] counts = process.GetHitCounts (new Breakpoint[] { bpt });
+			Assert.AreEqual (exp_count, counts [0], "hit count of {0}", bpt);
+		}
+
+		[Test]
+		[Category("Breakpoints")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			//
+			// A counting probe never stops the target.
+			//
+
+			Breakpoint bpt_probe = AssertConditionalBreakpoint (
+				thread, "probe", BreakpointCondition.Counter ());
+
+			AssertExecute ("next");
+			AssertStopped (thread, "main+1", "X.Main()");
+			AssertHitCount (process, bpt_probe, 25);
+
+			//
+			// Stop on every 10th hit, after ignoring the first three.
+			//
+
+			BreakpointCondition sample = new BreakpointCondition ();
+			sample.IgnoreCount = 3;
+			sample.SampleInterval = 10;
+			Breakpoint bpt_sample = AssertConditionalBreakpoint (thread, "sample", sample);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_sample.Index, "X.Sample(int)", GetLine ("sample"));
+			AssertPrint (thread, "i", "(int) 13");
+			AssertHitCount (process, bpt_sample, 13);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_sample.Index, "X.Sample(int)", GetLine ("sample"));
+			AssertPrint (thread, "i", "(int) 23");
+			AssertHitCount (process, bpt_sample, 23);
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Done");
+			AssertTargetExited (thread.Process);
+		}
+	}
+}
@@ -0,0 +1,74 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	//
+	// Stress test: 256 threads hitting the same breakpoint at the same time;
+	// prints the number of breakpoint events per second.
+	//
+	[DebuggerTestFixture(Timeout = 300000)]
+	public class TestManyThreads : DebuggerTestFixture
+	{
+		public TestManyThreads ()
+			: base ("TestManyThreads")
+		{
+			Config.ThreadingModel = ThreadingModel.Process;
+		}
+
+		const int NumThreads = 256;
+
+		public override void SetUp ()
+		{
+			base.SetUp ();
+			Interpreter.IgnoreThreadCreation = true;
+		}
+
+		[Test]
+		[Category("Threads")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+
+			Thread thread = process.MainThread;
+			AssertStopped (thread, "main", "X.Main()");
+
+			int bpt_hit = GetBreakpoint ("hit");
+
+			DateTime start = DateTime.Now;
+
+			int hits = 0;
+			while (hits < NumThreads) {
+				AssertExecute ("continue");
+
+				DebuggerEvent e = AssertEvent ();
+				if (e.Type != DebuggerEventType.TargetEvent)
+					Assert.Fail ("Received unexpected event {0}", e);
+
+				TargetEventArgs args = (TargetEventArgs) e.Data2;
+				if ((args.Type != TargetEventType.TargetHitBreakpoint) ||
+				    ((int) args.Data != bpt_hit))
+					Assert.Fail ("Received unexpected event {0}", e);
+
+				AssertFrame ((Thread) e.Data, "hit", "X.Hit()");
+				hits++;
+			}
+
+			TimeSpan elapsed = DateTime.Now - start;
+			Console.WriteLine ("{0}: {1} breakpoint events in {2:0.000} seconds " +
+					   "({3:0.0} events/second)", GetType ().Name, hits,
+					   elapsed.TotalSeconds, hits / elapsed.TotalSeconds);
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Hits: " + NumThreads);
+			AssertTargetExited (thread.Process);
+		}
+	}
+}
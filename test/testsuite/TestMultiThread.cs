@@ -23,6 +23,16 @@ namespace Mono.Debugger.Tests
 
 		int bpt_loop;
 
+		void AssertRegisters (Thread thread, Registers regs)
+		{
+			Assert.IsNotNull (regs);
+
+			Registers expected = thread.GetRegisters ();
+			foreach (Register reg in expected.ImportantRegisters)
+				Assert.AreEqual (reg.Value, regs [reg.Index].Value,
+						 "register {0} of {1}", reg.Name, thread);
+		}
+
 		[Test]
 		[Category("Threads")]
 		public void Main ()
@@ -123,6 +133,10 @@ namespace Mono.Debugger.Tests
 			AssertFrame (thread, "X.LoopDone()", LineLoop);
 			AssertFrame (child, "X.LoopDone()", LineLoop);
 
+			Registers[] regs = process.GetRegisters (new Thread[] { thread, child });
+			AssertRegisters (thread, regs [0]);
+			AssertRegisters (child, regs [1]);
+
 			AssertExecute ("continue -wait -thread " + thread.ID);
 			AssertTargetOutput ("Loop: child 3");
 
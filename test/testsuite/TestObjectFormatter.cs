@@ -0,0 +1,124 @@
+using System;
+using System.Text;
+using System.Text.RegularExpressions;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestObjectFormatter : DebuggerTestFixture
+	{
+		public TestObjectFormatter ()
+			: base ("TestObjectFormatter")
+		{ }
+
+		static string FormatRange (int start, int count, int more)
+		{
+			StringBuilder sb = new StringBuilder ("[ ");
+			for (int i = 0; i < count; i++) {
+				if (i > 0)
+					sb.Append (", ");
+				sb.Append (start + i);
+			}
+			if (more > 0)
+				sb.AppendFormat (", ... ({0} more)", more);
+			sb.Append (" ]");
+			return sb.ToString ();
+		}
+
+		static string FormatMatrix (int rows, int columns)
+		{
+			StringBuilder sb = new StringBuilder ("[ ");
+			for (int i = 0; i < rows; i++) {
+				if (i > 0)
+					sb.Append (", ");
+				sb.Append (FormatRange (i * columns, columns, 0));
+			}
+			sb.Append (" ]");
+			return sb.ToString ();
+		}
+
+		void AssertPrintJagged (Thread thread, string exp_result)
+		{
+			AssertPrintRegex (thread, DisplayFormat.Object, "jagged",
+					  @"^\(int\[\]\[\]\) " + Regex.Escape (exp_result) + "$");
+		}
+
+		[Test]
+		[Category("ManagedTypes")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, "main", "X.Main()");
+
+			int page_size = ObjectFormatter.PageSize;
+			int max_elements = ObjectFormatter.MaxArrayElements;
+			int max_length = ObjectFormatter.MaxStringLength;
+
+			try {
+				//
+				// The default limits.
+				//
+
+				AssertPrint (thread, "big",
+					     "(int[]) " + FormatRange (0, max_elements, 1500 - max_elements));
+				AssertPrint (thread, "text",
+					     "(string) \"" + new String ('x', max_length) + "\" ... (" +
+					     (12000 - max_length) + " more)");
+
+				//
+				// Small pages and limits; the elements of all the rows of a
+				// multi-dimensional or jagged array share one limit.
+				//
+
+				ObjectFormatter.PageSize = 2;
+				ObjectFormatter.MaxArrayElements = 5;
+				ObjectFormatter.MaxStringLength = 10;
+
+				AssertPrint (thread, "big", "(int[]) " + FormatRange (0, 5, 1495));
+				AssertPrint (thread, "text", "(string) \"xxxxxxxxxx\" ... (11990 more)");
+				AssertPrint (thread, "matrix", "(int[,]) [ " + FormatRange (0, 5, 35) +
+					     ", ... (39 more) ]");
+				AssertPrintJagged (thread, "[ " + FormatRange (0, 5, 35) + ", ... (39 more) ]");
+
+				ObjectFormatter.MaxArrayElements = 45;
+
+				AssertPrint (thread, "matrix", "(int[,]) [ " + FormatRange (0, 40, 0) +
+					     ", " + FormatRange (40, 5, 35) + ", ... (38 more) ]");
+				AssertPrintJagged (thread, "[ " + FormatRange (0, 40, 0) + ", " +
+						   FormatRange (40, 5, 35) + ", ... (38 more) ]");
+
+				//
+				// 0 means no limit.
+				//
+
+				ObjectFormatter.PageSize = 64;
+				ObjectFormatter.MaxArrayElements = 0;
+				ObjectFormatter.MaxStringLength = 0;
+
+				AssertPrint (thread, "big", "(int[]) " + FormatRange (0, 1500, 0));
+				AssertPrint (thread, "text", "(string) \"" + new String ('x', 12000) + "\"");
+				AssertPrint (thread, "matrix", "(int[,]) " + FormatMatrix (40, 40));
+				AssertPrintJagged (thread, FormatMatrix (40, 40));
+			} finally {
+				ObjectFormatter.PageSize = page_size;
+				ObjectFormatter.MaxArrayElements = max_elements;
+				ObjectFormatter.MaxStringLength = max_length;
+			}
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("1500 12000");
+			AssertTargetExited (thread.Process);
+		}
+	}
+}
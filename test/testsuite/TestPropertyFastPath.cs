@@ -0,0 +1,72 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestPropertyFastPath : DebuggerTestFixture
+	{
+		public TestPropertyFastPath ()
+			: base ("TestPropertyFastPath")
+		{
+			Config.NestedBreakStates = true;
+		}
+
+		//
+		// Evaluate @expression with nested break states enabled, so we'd stop
+		// at the breakpoint in the getter if we invoked it.
+		//
+		void AssertNoInvoke (string expression, string exp_result)
+		{
+			AssertExecuteInBackground ("print -nested-break " + expression);
+
+			DebuggerEvent e = AssertEvent (DebuggerEventType.CommandDone);
+			Assert.AreEqual (exp_result, e.Data);
+		}
+
+		[Test]
+		[Category("ManagedTypes")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			AssertBreakpoint (GetLine ("name"));
+			int bpt_greeting = AssertBreakpoint (GetLine ("greeting"));
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, "print", "X.Main()");
+
+			AssertNoInvoke ("test.Name", "(string) \"Test\"");
+			AssertNoInvoke ("test.Answer", "(int) 42");
+			AssertFrame (thread, "X.Main()", GetLine ("print"));
+
+			//
+			// This getter isn't trivial, so we have to invoke it.
+			//
+			AssertExecuteInBackground ("print -nested-break test.Greeting");
+			AssertNestedBreakState (thread, "Test.get_Greeting()", GetLine ("greeting"));
+
+			AssertExecute ("continue");
+
+			DebuggerEvent e = AssertEvent (DebuggerEventType.CommandDone);
+			Assert.AreEqual ("(string) \"Hello Test\"", e.Data);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_greeting, "Test.get_Greeting()", GetLine ("greeting"));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Hello Test");
+			AssertTargetExited (process);
+		}
+	}
+}
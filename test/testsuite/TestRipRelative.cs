@@ -0,0 +1,85 @@
+using System;
+using NUnit.Framework;
+
+using Mono.Debugger;
+using Mono.Debugger.Languages;
+using Mono.Debugger.Frontend;
+using Mono.Debugger.Test.Framework;
+
+namespace Mono.Debugger.Tests
+{
+	[DebuggerTestFixture]
+	public class TestRipRelative : DebuggerTestFixture
+	{
+		public TestRipRelative ()
+			: base ("TestRipRelative")
+		{ }
+
+		[Test]
+		[Category("Breakpoints")]
+		public void Main ()
+		{
+			Process process = Start ();
+			Assert.IsTrue (process.IsManaged);
+			Assert.IsTrue (process.MainThread.IsStopped);
+			Thread thread = process.MainThread;
+
+			AssertStopped (thread, "main", "X.Main()");
+
+			int bpt_scale = AssertBreakpoint (GetLine ("scale"));
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_scale, "X.Scale(double)", GetLine ("scale"));
+
+			//
+			// Find the instruction which loads the constant.
+			//
+
+			TargetAddress rip_insn = TargetAddress.Null;
+			StackFrame frame = thread.CurrentFrame;
+			AssemblerMethod asm = thread.DisassembleMethod (frame.Method);
+			foreach (AssemblerLine line in asm.Lines) {
+				if (line.Address < frame.TargetAddress)
+					continue;
+				if (line.Text.Contains ("(%rip)")) {
+					rip_insn = line.Address;
+					break;
+				}
+			}
+			Assert.IsFalse (rip_insn.IsNull,
+					"No RIP-relative instruction in X.Scale(double).");
+
+			AssertExecute ("delete " + bpt_scale);
+
+			int bpt_rip = Interpreter.Session.InsertBreakpoint (
+				thread, ThreadGroup.Global, rip_insn).Index;
+
+			if (rip_insn != frame.TargetAddress) {
+				AssertExecute ("continue");
+				AssertHitBreakpoint (thread, bpt_rip, "X.Scale(double)", GetLine ("scale"));
+			}
+
+			//
+			// `finish' steps over the breakpoint and then continues until we
+			// return to Main(); the instruction must still read the constant.
+			//
+
+			AssertExecute ("finish");
+			AssertStopped (thread, "X.Main()", GetLine ("main"));
+
+			AssertExecute ("next");
+			AssertStopped (thread, "X.Main()", GetLine ("main") + 1);
+
+			AssertExecute ("next");
+			AssertTargetOutput ("Scale 10");
+			AssertStopped (thread, "X.Main()", GetLine ("main") + 2);
+
+			AssertExecute ("continue");
+			AssertHitBreakpoint (thread, bpt_rip, "X.Scale(double)", GetLine ("scale"));
+
+			AssertExecute ("continue");
+			AssertTargetOutput ("Scale 15");
+			AssertTargetExited (thread.Process);
+		}
+	}
+}